@@ -24,11 +24,20 @@ echo Компиляция исходных файлов...
 cl /LD /EHsc /I. /Iinclude /D FLIGHT_SCHEDULE_EXPORTS /MDd /Zi /Od /W3 /std:c++17 ^
    src\FlightScheduleAPI.cpp ^
    src\Schedule.cpp ^
+   src\ConcurrentSchedule.cpp ^
+   src\LocalTimeCache.cpp ^
+   src\FlightStatusTracker.cpp ^
+   src\Clock.cpp ^
+   src\CargoDeadlineIndex.cpp ^
+   src\EventEngine.cpp ^
+   src\DelayPropagator.cpp ^
+   src\FlightCursor.cpp ^
    src\Flight.cpp ^
    src\Aircraft.cpp ^
    src\Airport.cpp ^
    src\Cargo.cpp ^
    src\UrgentCargo.cpp ^
+   src\UrgentCargoRegistry.cpp ^
    src\Passenger.cpp ^
    /Fe:x64\Debug\FlightScheduleAPI.dll ^
    /link /DLL /MACHINE:X64
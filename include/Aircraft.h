@@ -7,8 +7,10 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <ctime>
 #include "Cargo.h"
 #include "UrgentCargo.h"
+#include "UrgentCargoRegistry.h"
 #include "Passenger.h"
 
 
@@ -18,9 +20,10 @@ private:
     std::string aircraftNumber;                          ///< Номер самолёта
     double maxPayload;                                  ///< Максимальная грузоподъёмность в кг
     std::vector<std::shared_ptr<Cargo>> cargoList;      ///< Список грузов на борту
-    std::vector<std::shared_ptr<UrgentCargo>> urgentCargoList; ///< Список срочных грузов на борту
+    UrgentCargoRegistry urgentCargoRegistry;            ///< Срочные грузы, их сроки и записи в общем индексе сети
     std::vector<std::shared_ptr<Passenger>> passengerList;     ///< Список пассажиров на борту
 
+
 public:
     // Конструкторы
     /**
@@ -67,6 +70,7 @@ public:
     // Методы для работы с грузами
     bool addCargo(std::shared_ptr<Cargo> cargo);        ///< Добавить груз (возвращает true если успешно)
     bool addUrgentCargo(std::shared_ptr<UrgentCargo> urgentCargo); ///< Добавить срочный груз
+    bool addUrgentCargo(std::shared_ptr<UrgentCargo> urgentCargo, std::time_t now); ///< Добавить срочный груз (срок проверяется на момент now)
     void removeCargo(const std::string& cargoNumber);
     void removeUrgentCargo(const std::string& cargoNumber);
     std::shared_ptr<Cargo> findCargo(const std::string& cargoNumber) const;
@@ -88,7 +92,13 @@ public:
     
     // Методы для поиска
     std::vector<std::shared_ptr<UrgentCargo>> getOverdueCargo() const;  ///< Получить просроченные срочные грузы
+    std::vector<std::shared_ptr<UrgentCargo>> getOverdueCargo(std::time_t now) const; ///< Получить грузы, просроченные на момент now
     std::vector<std::shared_ptr<UrgentCargo>> getUrgentCargo() const;   ///< Получить срочные грузы
+    std::vector<std::shared_ptr<UrgentCargo>> getUrgentCargo(std::time_t now) const;  ///< Получить грузы, срочные на момент now
+    
+    // Индекс сроков сети
+    void setDeadlineIndex(std::shared_ptr<CargoDeadlineIndex> index); ///< Подключить общий индекс сроков (nullptr — отключить)
+    std::shared_ptr<CargoDeadlineIndex> getDeadlineIndex() const;     ///< Получить подключённый общий индекс сроков
 };
 
 #endif // AIRCRAFT_H
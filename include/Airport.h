@@ -7,8 +7,10 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <ctime>
 #include "Cargo.h"
 #include "UrgentCargo.h"
+#include "UrgentCargoRegistry.h"
 #include "Passenger.h"
 
 // Предварительное объявление класса Aircraft
@@ -19,10 +21,11 @@ class Airport {
 private:
     std::string name;                                    ///< Название аэропорта
     std::vector<std::shared_ptr<Cargo>> cargoList;      ///< Список грузов в аэропорту
-    std::vector<std::shared_ptr<UrgentCargo>> urgentCargoList; ///< Список срочных грузов
+    UrgentCargoRegistry urgentCargoRegistry;            ///< Срочные грузы, их сроки и записи в общем индексе сети
     std::vector<std::shared_ptr<Passenger>> passengerList;     ///< Список пассажиров
     std::vector<std::shared_ptr<Aircraft>> aircraftList; ///< Список самолётов в аэропорту
 
+
 public:
     // Конструкторы
     Airport();
@@ -72,7 +75,13 @@ public:
     
     // Методы для поиска
     std::vector<std::shared_ptr<UrgentCargo>> getOverdueCargo() const;  ///< Получить просроченные срочные грузы
+    std::vector<std::shared_ptr<UrgentCargo>> getOverdueCargo(std::time_t now) const; ///< Получить грузы, просроченные на момент now
     std::vector<std::shared_ptr<UrgentCargo>> getUrgentCargo() const;   ///< Получить срочные грузы
+    std::vector<std::shared_ptr<UrgentCargo>> getUrgentCargo(std::time_t now) const;  ///< Получить грузы, срочные на момент now
+    
+    // Индекс сроков сети
+    void setDeadlineIndex(std::shared_ptr<CargoDeadlineIndex> index); ///< Подключить общий индекс сроков (nullptr — отключить)
+    std::shared_ptr<CargoDeadlineIndex> getDeadlineIndex() const;     ///< Получить подключённый общий индекс сроков
 };
 
 #endif // AIRPORT_H
@@ -0,0 +1,53 @@
+//! \file CargoDeadlineIndex.h
+//! \brief Упорядоченный по крайнему сроку индекс срочных грузов (просроченные и срочные за O(log n + k)).
+
+#ifndef CARGO_DEADLINE_INDEX_H
+#define CARGO_DEADLINE_INDEX_H
+
+#include <ctime>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "UrgentCargo.h"
+
+//! Запись индекса: груз и его местонахождение.
+struct CargoDeadlineEntry {
+    std::shared_ptr<UrgentCargo> cargo;  ///< Срочный груз
+    const void* holder;                  ///< Владелец записи (самолёт или аэропорт), nullptr для локального индекса
+    std::string location;                ///< Местонахождение для отчётов (например, "Aircraft A1")
+};
+
+/**
+ * @class CargoDeadlineIndex
+ * @brief Срочные грузы, упорядоченные по крайнему сроку
+ *
+ * Просроченные грузы (срок < now) и срочные (срок < now + 24 ч) образуют префикс
+ * упорядоченного индекса, поэтому выборка стоит O(log n + k), где k — размер ответа.
+ * Предикаты совпадают с UrgentCargo::isOverdue(now) и UrgentCargo::isUrgent(now);
+ * грузы без крайнего срока в индекс не попадают.
+ *
+ * Запись ищется по сроку, поэтому крайний срок груза следует менять, предварительно
+ * убрав груз из индекса (иначе удаление переходит к полному перебору).
+ */
+class CargoDeadlineIndex {
+private:
+    std::multimap<std::time_t, CargoDeadlineEntry> entries;  ///< Записи по крайнему сроку
+
+    std::vector<CargoDeadlineEntry> collect(std::time_t from, std::time_t to) const; ///< Записи со сроком в [from, to)
+
+public:
+    static const std::time_t URGENT_WINDOW = 24 * 60 * 60;  ///< Окно срочности (как в UrgentCargo::isUrgent)
+
+    bool add(std::shared_ptr<UrgentCargo> cargo, const void* holder = nullptr,
+             const std::string& location = "");              ///< Добавить груз (false, если нет груза или срока)
+    bool remove(const UrgentCargo* cargo, const void* holder = nullptr); ///< Убрать одну запись груза данного владельца
+    void clear();                                            ///< Убрать все записи
+    size_t size() const;                                     ///< Количество записей
+
+    std::vector<CargoDeadlineEntry> getOverdue(std::time_t now) const; ///< Просроченные на момент now (по сроку)
+    std::vector<CargoDeadlineEntry> getUrgent(std::time_t now) const;  ///< Срочные на момент now, включая просроченные (по сроку)
+    std::vector<CargoDeadlineEntry> getDueInRange(std::time_t from, std::time_t to) const; ///< Грузы со сроком в [from, to) (по сроку)
+};
+
+#endif // CARGO_DEADLINE_INDEX_H
@@ -0,0 +1,42 @@
+//! \file Clock.h
+//! \brief Источник текущего времени: системные часы и ручные часы для моделирования и тестов.
+
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <ctime>
+
+/**
+ * @class Clock
+ * @brief Абстрактный источник текущего момента времени
+ *
+ * Отчёты и проверки по времени читают момент один раз на пакет и передают его
+ * в методы вида isOverdue(now), поэтому все ответы в пределах пакета согласованы.
+ * Подмена часов позволяет прогонять исторические сутки с произвольной скоростью.
+ */
+class Clock {
+public:
+    virtual ~Clock();
+    virtual std::time_t now() const = 0;  ///< Текущий момент (Unix time)
+};
+
+//! Системные часы: std::time(nullptr).
+class SystemClock : public Clock {
+public:
+    std::time_t now() const override;
+};
+
+//! Ручные часы: момент задаётся и сдвигается явно.
+class ManualClock : public Clock {
+private:
+    std::time_t current;  ///< Текущий момент часов
+
+public:
+    explicit ManualClock(std::time_t time = 0);
+    
+    std::time_t now() const override;
+    void setTime(std::time_t time);     ///< Установить текущий момент
+    void advance(std::time_t seconds);  ///< Сдвинуть часы на заданное число секунд
+};
+
+#endif // CLOCK_H
@@ -0,0 +1,111 @@
+//! \file ConcurrentSchedule.h
+//! \brief Расписание для многопоточного доступа: параллельные читатели и пакетные писатели (std::shared_mutex).
+
+#ifndef CONCURRENT_SCHEDULE_H
+#define CONCURRENT_SCHEDULE_H
+
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Schedule.h"
+
+/**
+ * @class ConcurrentSchedule
+ * @brief Schedule под блокировкой читателей-писателей
+ *
+ * Чтения берут разделяемую блокировку и друг друга не ждут; изменения берут
+ * исключительную. Методы-читатели возвращают копии рейсов: Schedule меняет
+ * рейсы на месте (перенос, передача самолёту, завершение), поэтому указатели
+ * на рейсы расписания нельзя разыменовывать после снятия блокировки.
+ *
+ * Для нескольких изменений подряд следует использовать addFlights() или write():
+ * вся пачка выполняется в одной исключительной секции, читатели видят её целиком
+ * или не видят вовсе. read() даёт доступ к расписанию без копирования (участки
+ * FlightRange, отчёты) на время разделяемой блокировки.
+ *
+ * Счётчики статусов (getScheduledFlights, getInProgressFlights) продвигают
+ * трекер расписания под его собственным мьютексом, поэтому их можно вызывать
+ * и в read(), и через getStatusCounts().
+ *
+ * Писатели имеют приоритет: ждущий писатель держит writerGate, и новые читатели
+ * ждут его, а не проходят вперёд. Без этого rwlock glibc (по умолчанию отдающий
+ * предпочтение читателям) при непрерывном потоке чтений задерживает вставки
+ * на порядок. Писатель ждёт только читателей, уже взявших разделяемую блокировку.
+ */
+class ConcurrentSchedule {
+private:
+    mutable std::shared_mutex mutex;  ///< Разделяемая блокировка для чтения, исключительная для изменений
+    mutable std::mutex writerGate;    ///< Занят писателем на время ожидания исключительной блокировки
+    Schedule schedule;                ///< Расписание
+
+    std::shared_lock<std::shared_mutex> lockShared() const;  ///< Разделяемая блокировка после ждущих писателей
+    std::unique_lock<std::shared_mutex> lockExclusive();     ///< Исключительная блокировка без пропуска новых читателей
+
+    static std::shared_ptr<Flight> copyFlight(const std::shared_ptr<Flight>& flight); ///< Копия рейса (nullptr для nullptr)
+    static std::vector<std::shared_ptr<Flight>> copyFlights(const FlightRange& range); ///< Копии рейсов участка
+
+public:
+    //! Счётчики рейсов по статусам на один момент.
+    struct StatusCounts {
+        int total;       ///< Всего рейсов
+        int scheduled;   ///< Запланированные
+        int inProgress;  ///< В полёте
+        int completed;   ///< Завершённые
+    };
+
+    ConcurrentSchedule();
+
+    ConcurrentSchedule(const ConcurrentSchedule&) = delete;
+    ConcurrentSchedule& operator=(const ConcurrentSchedule&) = delete;
+
+    /**
+     * @brief Выполнить чтение под разделяемой блокировкой
+     * @param reader Функция, получающая const Schedule&; её результат возвращается
+     */
+    template <class Reader>
+    auto read(Reader reader) const -> decltype(reader(std::declval<const Schedule&>())) {
+        std::shared_lock<std::shared_mutex> lock = lockShared();
+        return reader(static_cast<const Schedule&>(schedule));
+    }
+
+    /**
+     * @brief Выполнить изменения одной исключительной секцией
+     * @param writer Функция, получающая Schedule&; её результат возвращается
+     */
+    template <class Writer>
+    auto write(Writer writer) -> decltype(writer(std::declval<Schedule&>())) {
+        std::unique_lock<std::shared_mutex> lock = lockExclusive();
+        return writer(schedule);
+    }
+
+    // Изменения (исключительная блокировка)
+    bool addFlight(std::shared_ptr<Flight> flight);  ///< Добавить рейс (см. Schedule::addFlight)
+    int addFlights(const std::vector<std::shared_ptr<Flight>>& newFlights,
+                   std::vector<FlightCheckStatus>* statuses = nullptr); ///< Добавить пачку рейсов одной секцией
+    void removeFlight(const std::string& flightNumber); ///< Удалить рейс
+    FlightCheckResult tryAddFlight(std::shared_ptr<Flight> flight); ///< Добавить рейс без конфликтов
+    FlightCheckResult rescheduleFlight(const std::string& flightNumber, std::time_t newDeparture, std::time_t newArrival,
+                                       bool rejectConflicts = true); ///< Перенести рейс
+    void completeFlight(const std::string& flightNumber); ///< Завершить рейс
+
+    // Чтения (разделяемая блокировка, результаты — копии)
+    std::shared_ptr<Flight> findFlight(const std::string& flightNumber) const; ///< Копия рейса по номеру (nullptr, если нет)
+    std::vector<std::shared_ptr<Flight>> getFlightsInTimeRange(std::time_t startTime, std::time_t endTime) const; ///< Копии рейсов с вылетом в [startTime, endTime]
+    std::vector<std::shared_ptr<Flight>> getFlightsByAircraftInRange(const std::string& aircraftId, std::time_t startTime,
+                                                                     std::time_t endTime) const; ///< Копии рейсов самолёта с вылетом в диапазоне
+    FlightCheckResult checkFlight(const Flight& flight) const; ///< Проверить рейс на конфликты
+    bool getChangesSince(std::uint64_t sinceVersion, std::vector<ScheduleChange>& changes,
+                         size_t maxChanges = SIZE_MAX) const; ///< Изменения после версии
+    std::uint64_t getVersion() const;               ///< Текущая версия расписания
+    int getTotalFlights() const;                    ///< Общее количество рейсов
+    bool isValid() const;                           ///< Проверить корректность расписания
+
+    StatusCounts getStatusCounts() const;           ///< Счётчики статусов на один момент
+};
+
+#endif // CONCURRENT_SCHEDULE_H
@@ -0,0 +1,68 @@
+//! \file DelayPropagator.h
+//! \brief Распространение задержки рейса по дальнейшим рейсам того же самолёта.
+
+#ifndef DELAY_PROPAGATOR_H
+#define DELAY_PROPAGATOR_H
+
+#include <ctime>
+#include <string>
+#include <vector>
+#include "Schedule.h"
+
+//! Изменение времени рейса в результате задержки.
+struct FlightDelayChange {
+    std::string flightNumber;  ///< Номер рейса
+    std::time_t oldDeparture;  ///< Вылет до задержки
+    std::time_t newDeparture;  ///< Вылет после задержки
+    std::time_t oldArrival;    ///< Прибытие до задержки
+    std::time_t newArrival;    ///< Прибытие после задержки
+};
+
+//! Результат распространения задержки.
+struct DelayPropagationResult {
+    FlightCheckStatus status;               ///< Ok; NotFound или InvalidFlight — задержка не применена; Overlap или Turnaround — остался конфликт за горизонтом
+    std::string conflictingFlight;          ///< Первый рейс за горизонтом, конфликтующий с последним сдвинутым рейсом
+    std::vector<FlightDelayChange> changes; ///< Сдвинутые рейсы в порядке ротации (первый — задержанный рейс)
+};
+
+/**
+ * @class DelayPropagator
+ * @brief Сдвиг дальнейших рейсов самолёта при задержке рейса
+ *
+ * Задержанный рейс сдвигается целиком, затем по списку рейсов самолёта
+ * просматриваются следующие за ним: рейс сдвигается, если его вылет раньше
+ * прибытия предыдущего плюс действующая минимальная стоянка
+ * (Schedule::getRequiredGroundTime, с учётом правил аэропортов). Просмотр
+ * останавливается на первом рейсе с достаточным запасом, поэтому стоимость
+ * пропорциональна числу сдвинутых рейсов, а не размеру расписания; полная
+ * проверка расписания не выполняется.
+ *
+ * Рейсы с вылетом дальше горизонта (по умолчанию сутки от исходного вылета
+ * задержанного рейса) не сдвигаются: если такой рейс оказывается в конфликте
+ * с последним сдвинутым, конфликт возвращается в результате.
+ */
+class DelayPropagator {
+private:
+    Schedule& schedule;        ///< Расписание, в котором распространяется задержка
+    std::time_t horizon;       ///< Горизонт сдвига от исходного вылета (0 — без ограничения)
+    bool respectGroundTime;    ///< Учитывать минимальную стоянку (иначе — только пересечения)
+
+public:
+    static const std::time_t DEFAULT_HORIZON = 24 * 60 * 60; ///< Горизонт по умолчанию — сутки
+
+    /**
+     * @brief Создать распространитель задержек для расписания
+     * @param schedule Расписание (должно существовать, пока используется распространитель)
+     */
+    explicit DelayPropagator(Schedule& schedule);
+
+    void setHorizon(std::time_t seconds);         ///< Горизонт сдвига, секунды (0 или меньше — без ограничения)
+    std::time_t getHorizon() const;               ///< Получить горизонт сдвига
+    void setRespectGroundTime(bool respect);      ///< Учитывать минимальную стоянку при сдвиге
+    bool isRespectingGroundTime() const;          ///< Учитывается ли минимальная стоянка
+
+    DelayPropagationResult computeDelay(const std::string& flightNumber, std::time_t delay) const; ///< Рассчитать сдвиги без изменения расписания
+    DelayPropagationResult applyDelay(const std::string& flightNumber, std::time_t delay);         ///< Рассчитать и применить сдвиги
+};
+
+#endif // DELAY_PROPAGATOR_H
@@ -0,0 +1,102 @@
+//! \file EventEngine.h
+//! \brief Движок событий на иерархическом колесе таймеров: вылеты, прибытия, просрочка грузов.
+
+#ifndef EVENT_ENGINE_H
+#define EVENT_ENGINE_H
+
+#include <cstdint>
+#include <ctime>
+#include <deque>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//! Тип события расписания.
+enum class ScheduleEventType {
+    FlightDeparted = 0,  ///< Рейс вылетел (now >= вылета)
+    FlightArrived = 1,   ///< Рейс прибыл (now > прибытия)
+    CargoOverdue = 2     ///< Срочный груз просрочен (now > крайнего срока)
+};
+
+//! Событие расписания.
+struct ScheduleEvent {
+    ScheduleEventType type;  ///< Тип события
+    std::time_t time;        ///< Момент по расписанию (вылет, прибытие или крайний срок)
+    std::string subject;     ///< Номер рейса или груза
+    std::string location;    ///< Аэропорт вылета/прибытия или местонахождение груза
+};
+
+/**
+ * @class EventEngine
+ * @brief Таймеры событий с доставкой пакетами при продвижении часов
+ *
+ * Таймеры хранятся в иерархическом колесе: 11 уровней по 64 ячейки, уровень L
+ * содержит таймеры, срок которых отличается от текущего момента в разрядах
+ * [6L, 6L + 6). Занятые ячейки отмечены битовыми масками, поэтому advanceTo()
+ * переходит сразу к ближайшей занятой ячейке, не перебирая пустые секунды;
+ * таймер спускается по уровням не более 11 раз. Стоимость продвижения часов
+ * пропорциональна числу наступивших событий, а не числу таймеров.
+ *
+ * События, наступившие за один вызов advanceTo(), доставляются одним пакетом
+ * в порядке срока (при равных сроках — в порядке постановки): всем слушателям
+ * и, если включено, в очередь для опроса poll(). Перевод часов назад игнорируется.
+ *
+ * Отменённый таймер остаётся в своей ячейке до её обработки. Когда таких записей
+ * становится больше, чем действующих (и не меньше COMPACT_MIN_CANCELLED), колесо
+ * очищается от них целиком: при частых переносах рейсов колесо не растёт
+ * между продвижениями часов, а стоимость очистки делится между отменами.
+ */
+class EventEngine {
+public:
+    using TimerId = std::uint64_t;                                           ///< Идентификатор таймера (0 — нет таймера)
+    using EventCallback = std::function<void(const std::vector<ScheduleEvent>&)>; ///< Получатель пакета событий
+
+private:
+    static const int LEVEL_BITS = 6;                 ///< Разрядов времени на уровень
+    static const int SLOTS = 1 << LEVEL_BITS;        ///< Ячеек на уровне
+    static const int LEVELS = 11;                    ///< Уровней (покрывают все 64 разряда)
+    static const size_t COMPACT_MIN_CANCELLED = 1024; ///< Наименьшее число отменённых записей для очистки колеса
+
+    //! Таймер в ячейке колеса (срок хранится в беззнаковой шкале, см. toWheelTime).
+    struct Timer {
+        std::uint64_t due;  ///< Срок срабатывания
+        TimerId id;         ///< Идентификатор таймера
+    };
+
+    std::vector<Timer> slots[LEVELS][SLOTS];         ///< Ячейки колеса по уровням
+    std::uint64_t occupied[LEVELS];                  ///< Маски занятых ячеек по уровням
+    std::uint64_t current;                           ///< Текущий момент часов колеса
+    TimerId nextId;                                  ///< Следующий идентификатор таймера
+    std::unordered_map<TimerId, ScheduleEvent> pending; ///< События действующих таймеров (отменённые удаляются)
+    std::vector<EventCallback> listeners;            ///< Слушатели пакетов событий
+    std::deque<ScheduleEvent> queue;                 ///< Очередь событий для опроса
+    bool queueEnabled;                               ///< Копить ли события в очереди
+    size_t cancelledCount;                           ///< Отменённые таймеры, ещё лежащие в ячейках
+
+    static std::uint64_t toWheelTime(std::time_t time); ///< Время со знаком в монотонную беззнаковую шкалу
+    static std::time_t fromWheelTime(std::uint64_t time); ///< Обратное преобразование
+    void place(const Timer& timer);                  ///< Поместить таймер на уровень по сроку относительно current
+    void compact();                                  ///< Убрать отменённые таймеры из всех ячеек
+
+public:
+    /**
+     * @brief Создать пустой движок
+     * @param now Начальный момент часов (Unix time)
+     */
+    explicit EventEngine(std::time_t now = 0);
+
+    TimerId schedule(std::time_t dueTime, ScheduleEvent event); ///< Поставить событие на момент dueTime (0, если момент уже наступил)
+    bool cancel(TimerId id);                         ///< Отменить таймер (false, если уже сработал или отменён)
+    size_t advanceTo(std::time_t time);              ///< Продвинуть часы и доставить наступившие события, вернуть их число
+    std::time_t getTime() const;                     ///< Текущий момент часов движка
+    size_t getPendingCount() const;                  ///< Число ожидающих таймеров
+    size_t getWheelSize() const;                     ///< Число записей в ячейках колеса, включая отменённые
+
+    void addListener(EventCallback callback);        ///< Добавить слушателя пакетов событий
+    void setQueueEnabled(bool enabled);              ///< Включить (выключить и очистить) очередь для опроса
+    std::vector<ScheduleEvent> poll(size_t maxEvents); ///< Забрать до maxEvents событий из очереди
+    size_t getQueuedCount() const;                   ///< Число событий в очереди
+};
+
+#endif // EVENT_ENGINE_H
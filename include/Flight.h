@@ -73,7 +73,9 @@ public:
     std::time_t getFlightDuration() const;              ///< Получить продолжительность рейса в секундах
     double getFlightDurationHours() const;              ///< Получить продолжительность рейса в часах
     bool isInProgress() const;                          ///< Проверить, идёт ли рейс сейчас
+    bool isInProgress(std::time_t now) const;           ///< Проверить, идёт ли рейс в момент now
     bool isScheduled() const;                           ///< Проверить, запланирован ли рейс
+    bool isScheduled(std::time_t now) const;            ///< Проверить, запланирован ли рейс на момент now
     void completeFlight();                               ///< Завершить рейс
     
     // Методы для работы с обратным рейсом
@@ -85,6 +87,7 @@ public:
     
     // Общие методы
     std::string toString() const;                       ///< Получить строковое представление
+    std::string toString(std::time_t now) const;        ///< Получить строковое представление со статусом на момент now
     bool isValid() const;                               ///< Проверить корректность данных
     bool conflictsWith(const Flight& other) const;      ///< Проверить конфликт с другим рейсом
     
@@ -0,0 +1,68 @@
+//! \file FlightCursor.h
+//! \brief Постраничный обход рейсов расписания в порядке вылета с фильтрами по самолёту, аэропорту и времени.
+
+#ifndef FLIGHT_CURSOR_H
+#define FLIGHT_CURSOR_H
+
+#include <cstdint>
+#include <ctime>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "Schedule.h"
+
+//! Фильтры курсора; пустая строка — без фильтра.
+struct FlightCursorFilter {
+    std::string aircraftId;   ///< Только рейсы этого самолёта
+    std::string airportCode;  ///< Только рейсы с вылетом из аэропорта или прилётом в него
+    std::time_t startTime = std::numeric_limits<std::time_t>::min(); ///< Вылет не раньше
+    std::time_t endTime = std::numeric_limits<std::time_t>::max();   ///< Вылет не позже
+};
+
+/**
+ * @class FlightCursor
+ * @brief Обход рейсов расписания пакетами фиксированного размера
+ *
+ * Курсор не хранит итераторов: он запоминает время вылета последнего выданного
+ * рейса и номера выданных рейсов с этим временем. Каждый пакет начинается
+ * двоичным поиском по подходящему упорядоченному списку (самолёта, аэропорта
+ * или общему), поэтому изменение расписания между пакетами не делает курсор
+ * недействительным: обход продолжается по текущему содержимому с места остановки.
+ *
+ * Версия расписания (Schedule::getVersion) запоминается при открытии и при каждом
+ * пакете. Если она изменилась, выдача — не снимок: рейс, перенесённый вперёд
+ * после выдачи, может встретиться снова, а перенесённый назад — быть пропущен.
+ * Клиент сверяет версии и догружает изменения журналом (Schedule::getChangesSince).
+ *
+ * Курсор ссылается на расписание и должен быть закрыт до его уничтожения.
+ */
+class FlightCursor {
+private:
+    const Schedule& schedule;                      ///< Обходимое расписание
+    FlightCursorFilter filter;                     ///< Фильтры обхода
+    std::time_t resumeTime;                        ///< Вылет последнего выданного рейса (начало следующего пакета)
+    std::unordered_set<std::string> resumeNumbers; ///< Номера выданных рейсов с вылетом resumeTime
+    bool finished;                                 ///< Обход завершён
+    std::uint64_t openVersion;                     ///< Версия расписания при открытии
+    std::uint64_t readVersion;                     ///< Версия расписания при последнем пакете
+
+    FlightRange source(std::time_t from) const;    ///< Участок наиболее узкого подходящего списка с вылетом не раньше from
+
+public:
+    /**
+     * @brief Открыть курсор
+     * @param schedule Расписание (должно существовать, пока курсор открыт)
+     * @param filter Фильтры по самолёту, аэропорту и времени вылета
+     */
+    explicit FlightCursor(const Schedule& schedule, FlightCursorFilter filter = FlightCursorFilter());
+
+    size_t next(std::vector<std::shared_ptr<Flight>>& batch, size_t maxFlights); ///< Следующий пакет (не более maxFlights рейсов), вернуть его размер
+    bool isFinished() const;                       ///< Все рейсы выданы
+    std::uint64_t getOpenVersion() const;          ///< Версия расписания при открытии
+    std::uint64_t getReadVersion() const;          ///< Версия расписания при последнем пакете
+    bool isStale() const;                          ///< Расписание изменилось после открытия курсора
+};
+
+#endif // FLIGHT_CURSOR_H
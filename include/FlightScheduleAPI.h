@@ -18,7 +18,16 @@
 extern "C" {
 #endif
 
-// Forward declarations для C интерфейса
+/**
+ * Дескрипторы объектов модели (Flight, Aircraft, Airport, Cargo, UrgentCargo, Passenger)
+ * — ссылки со счётчиком: указатель на std::shared_ptr объекта. Add-функции не копируют
+ * объект, а разделяют владение им с контейнером, поэтому изменения через контейнер видны
+ * по дескриптору и наоборот. Исключение — рейс, который уже принадлежит расписанию (добавлен
+ * ранее или получен из Schedule_FindFlight): Schedule_AddFlight и Schedule_TryAddFlight
+ * добавляют его копию, потому что расписание меняет свои рейсы на месте.
+ * Каждый дескриптор (в том числе полученный из Schedule_FindFlight)
+ * освобождается своей Destroy-функцией; объект удаляется вместе с последней ссылкой.
+ */
 typedef void* ScheduleHandle;
 typedef void* FlightHandle;
 typedef void* AircraftHandle;
@@ -26,6 +35,159 @@ typedef void* AirportHandle;
 typedef void* CargoHandle;
 typedef void* UrgentCargoHandle;
 typedef void* PassengerHandle;
+typedef void* CursorHandle;
+
+/**
+ * Строковые геттеры (..._ToString, ..._GetName и т. п.) копируют строку в буфер
+ * вызывающей стороны с усечением и возвращают её полную длину в байтах без
+ * завершающего нуля. Если результат >= bufferSize, строка усечена; вызов с
+ * buffer = NULL и bufferSize = 0 только возвращает длину. Отчёты, которые могут
+ * быть большими, имеют варианты ...Alloc: строка целиком возвращается в памяти
+ * библиотеки (за одно форматирование) и освобождается FlightSchedule_FreeString.
+ */
+
+#define SCHEDULE_EVENT_TEXT_SIZE 64  ///< Размер строковых полей записи события
+
+/**
+ * \brief Запись события расписания для опроса из C/Python.
+ *
+ * type: 0 — рейс вылетел, 1 — рейс прибыл, 2 — срочный груз просрочен.
+ * Строковые поля завершаются нулём и обрезаются до SCHEDULE_EVENT_TEXT_SIZE - 1 байт.
+ */
+typedef struct ScheduleEventRecord {
+    int type;                                  ///< Тип события
+    long long time;                            ///< Момент по расписанию (вылет, прибытие или крайний срок)
+    char subject[SCHEDULE_EVENT_TEXT_SIZE];    ///< Номер рейса или груза
+    char location[SCHEDULE_EVENT_TEXT_SIZE];   ///< Аэропорт или местонахождение груза
+} ScheduleEventRecord;
+
+/**
+ * \brief Сдвиг рейса в результате распространения задержки.
+ *
+ * Номер рейса завершается нулём и обрезается до SCHEDULE_EVENT_TEXT_SIZE - 1 байт.
+ */
+typedef struct FlightDelayRecord {
+    char flightNumber[SCHEDULE_EVENT_TEXT_SIZE]; ///< Номер рейса
+    long long oldDeparture;                      ///< Вылет до задержки
+    long long newDeparture;                      ///< Вылет после задержки
+    long long oldArrival;                        ///< Прибытие до задержки
+    long long newArrival;                        ///< Прибытие после задержки
+} FlightDelayRecord;
+
+/**
+ * \brief Запись журнала изменений расписания: рейс после изменения (удалённый — перед удалением).
+ *
+ * type: 0 — добавлен, 1 — удалён, 2 — перенесён, 3 — передан другому самолёту, 4 — завершён.
+ * Строковые поля завершаются нулём и обрезаются до SCHEDULE_EVENT_TEXT_SIZE - 1 байт.
+ */
+typedef struct ScheduleChangeRecord {
+    long long version;                                 ///< Версия расписания после изменения
+    int type;                                          ///< Вид изменения
+    char flightNumber[SCHEDULE_EVENT_TEXT_SIZE];       ///< Номер рейса
+    char departureAirport[SCHEDULE_EVENT_TEXT_SIZE];   ///< Аэропорт вылета
+    char destinationAirport[SCHEDULE_EVENT_TEXT_SIZE]; ///< Аэропорт назначения
+    char aircraftId[SCHEDULE_EVENT_TEXT_SIZE];         ///< Бортовой номер самолёта
+    long long departureTime;                           ///< Время вылета
+    long long arrivalTime;                             ///< Время прибытия
+    int completed;                                     ///< 1, если рейс завершён
+} ScheduleChangeRecord;
+
+// Отрицательные результаты Schedule_GetChangesSince
+#define CHANGES_RESYNC_REQUIRED (-1)   ///< Журнал уже не содержит всех изменений: нужна полная загрузка
+#define CHANGES_INVALID_ARGUMENT (-2)  ///< Нет расписания или буфера, maxChanges <= 0 или version < 0
+
+/**
+ * \brief Рейс в пакете курсора (без форматирования текста).
+ *
+ * Строковые поля завершаются нулём и обрезаются до SCHEDULE_EVENT_TEXT_SIZE - 1 байт.
+ */
+typedef struct FlightRecord {
+    char flightNumber[SCHEDULE_EVENT_TEXT_SIZE];       ///< Номер рейса
+    char departureAirport[SCHEDULE_EVENT_TEXT_SIZE];   ///< Аэропорт вылета
+    char destinationAirport[SCHEDULE_EVENT_TEXT_SIZE]; ///< Аэропорт назначения
+    char aircraftId[SCHEDULE_EVENT_TEXT_SIZE];         ///< Бортовой номер самолёта
+    long long departureTime;                           ///< Время вылета
+    long long arrivalTime;                             ///< Время прибытия
+    int completed;                                     ///< 1, если рейс завершён
+} FlightRecord;
+
+/**
+ * \name Пакетное создание объектов
+ * Строковые поля записей передаются одной таблицей: запись содержит смещения
+ * строк (завершённых нулём) от начала таблицы. Итог по каждой записи пишется
+ * в массив statuses (может быть NULL); при внутренней ошибке записи, которые
+ * не успели обработать, получают BATCH_ROW_INVALID.
+ * \{
+ */
+#define BATCH_ROW_OK 0           ///< Запись добавлена
+#define BATCH_ROW_INVALID 1      ///< Смещение вне таблицы или объект некорректен
+#define BATCH_ROW_DUPLICATE 2    ///< Номер рейса уже занят (в расписании или ранее в пакете)
+#define BATCH_ROW_NO_CAPACITY 3  ///< Превышена грузоподъёмность самолёта
+
+//! Рейс пакета: смещения строк и время.
+typedef struct FlightRow {
+    int flightNumber;        ///< Смещение номера рейса
+    int departureAirport;    ///< Смещение аэропорта вылета
+    int destinationAirport;  ///< Смещение аэропорта назначения
+    int aircraftId;          ///< Смещение бортового номера
+    long long departureTime; ///< Время вылета
+    long long arrivalTime;   ///< Время прибытия
+} FlightRow;
+
+//! Груз пакета; при deadline != 0 создаётся срочный груз.
+typedef struct CargoRow {
+    int cargoNumber;         ///< Смещение номера груза
+    int departureAirport;    ///< Смещение аэропорта отправления
+    int destinationAirport;  ///< Смещение аэропорта назначения
+    int currentLocation;     ///< Смещение текущего местоположения
+    double mass;             ///< Масса, кг
+    long long arrivalTime;   ///< Время прибытия
+    long long deadline;      ///< Крайний срок доставки (0 — обычный груз)
+} CargoRow;
+
+//! Пассажир пакета.
+typedef struct PassengerRow {
+    int passengerNumber;     ///< Смещение номера пассажира
+    int name;                ///< Смещение имени
+    int departureAirport;    ///< Смещение аэропорта отправления
+    int destinationAirport;  ///< Смещение аэропорта назначения
+} PassengerRow;
+/** \} */
+
+#define FLIGHT_STATUS_SCHEDULED 0    ///< Рейс запланирован (now < вылета)
+#define FLIGHT_STATUS_IN_PROGRESS 1  ///< Рейс в полёте (вылет <= now <= прибытие)
+#define FLIGHT_STATUS_ARRIVED 2      ///< Рейс прибыл, но не завершён
+#define FLIGHT_STATUS_COMPLETED 3    ///< Рейс завершён
+
+/**
+ * \brief Столбцы рейсов для выгрузки в массивы (NumPy, pandas).
+ *
+ * Массивы выделяет вызывающая сторона, каждый на capacity строк; любой массив
+ * может быть NULL — тогда столбец не выгружается. Строки столбцов идут в порядке
+ * вылета. Бортовые номера и аэропорты выгружаются кодами общего словаря:
+ * код — порядковый номер строки в dictionary.
+ */
+typedef struct FlightColumns {
+    int capacity;                  ///< Размер массивов, строк
+    long long* departureTimes;     ///< Время вылета
+    long long* arrivalTimes;       ///< Время прибытия
+    int* aircraftCodes;            ///< Код бортового номера
+    int* departureCodes;           ///< Код аэропорта вылета
+    int* destinationCodes;         ///< Код аэропорта назначения
+    unsigned char* statuses;       ///< Статус рейса на момент часов расписания (FLIGHT_STATUS_*)
+    char* flightNumbers;           ///< Номера рейсов по flightNumberWidth байт (дополняются нулями, без нуля при полной ширине)
+    int flightNumberWidth;         ///< Ширина поля номера рейса, байт
+    char* dictionary;              ///< [выход] Строки словаря подряд, каждая с нулём; освобождается FlightSchedule_FreeString
+    int dictionaryCount;           ///< [выход] Число строк словаря
+    int dictionaryBytes;           ///< [выход] Размер словаря, байт
+    int maxFlightNumberLength;     ///< [выход] Длина самого длинного номера рейса (больше ширины — номера усечены)
+} FlightColumns;
+
+// ============================================
+// Strings API
+// ============================================
+
+FLIGHT_SCHEDULE_API void FlightSchedule_FreeString(char* text); ///< Освободить строку, возвращённую ...Alloc-функцией (NULL допустим)
 
 // ============================================
 // Schedule API
@@ -33,19 +195,214 @@ typedef void* PassengerHandle;
 
 FLIGHT_SCHEDULE_API ScheduleHandle Schedule_Create();
 FLIGHT_SCHEDULE_API void Schedule_Destroy(ScheduleHandle handle);
-FLIGHT_SCHEDULE_API int Schedule_AddFlight(ScheduleHandle handle, FlightHandle flight);
+FLIGHT_SCHEDULE_API int Schedule_AddFlight(ScheduleHandle handle, FlightHandle flight); ///< Добавить рейс (разделяется с дескриптором; рейс другого расписания копируется)
+
+/**
+ * \brief Добавить пакет рейсов одним слиянием.
+ *
+ * Вставка одного рейса сдвигает хвост упорядоченных списков (O(n)), поэтому загрузка
+ * множества рейсов через Schedule_AddFlight квадратична; для загрузки следует
+ * использовать эту функцию или Schedule_AddFlightsBatch. Рейсы разделяются
+ * с дескрипторами, как в Schedule_AddFlight.
+ *
+ * \param flights Массив из count дескрипторов (NULL-элемент получает BATCH_ROW_INVALID).
+ * \param statuses Массив из count кодов BATCH_ROW_* (может быть NULL).
+ * \return Число добавленных рейсов.
+ */
+FLIGHT_SCHEDULE_API int Schedule_AddFlights(ScheduleHandle handle, const FlightHandle* flights, int count, int* statuses);
+
+/**
+ * \brief Добавить рейс, только если он не конфликтует с рейсами того же самолёта.
+ *
+ * Рейс разделяется с дескриптором (изменения видны по нему); рейс, уже принадлежащий
+ * расписанию, добавляется копией, как в Schedule_AddFlight.
+ *
+ * \param conflictBuffer Буфер для номера рейса, с которым найден конфликт (может быть NULL).
+ * \return Код причины: 0 — добавлен, 1 — некорректный рейс, 2 — номер занят,
+ *         3 — пересечение, 4 — короткая стоянка, 5 — разрыв маршрута.
+ */
+FLIGHT_SCHEDULE_API int Schedule_TryAddFlight(ScheduleHandle handle, FlightHandle flight, char* conflictBuffer, int bufferSize);
+
+/**
+ * \brief Перенести рейс на новое время с сохранением порядка расписания.
+ *
+ * \param conflictBuffer Буфер для номера рейса, с которым найден конфликт (может быть NULL).
+ * \return Код причины как у Schedule_TryAddFlight; 6 — рейс не найден. При ненулевом коде рейс не меняется.
+ */
+FLIGHT_SCHEDULE_API int Schedule_RescheduleFlight(ScheduleHandle handle, const char* flightNumber, long long newDeparture,
+                                                  long long newArrival, char* conflictBuffer, int bufferSize);
+
+/**
+ * \brief Передать рейс другому самолёту.
+ *
+ * \param conflictBuffer Буфер для номера рейса, с которым найден конфликт (может быть NULL).
+ * \return Код причины как у Schedule_RescheduleFlight. При ненулевом коде рейс не меняется.
+ */
+FLIGHT_SCHEDULE_API int Schedule_ReassignAircraft(ScheduleHandle handle, const char* flightNumber, const char* aircraftId,
+                                                  char* conflictBuffer, int bufferSize);
+
+/**
+ * \brief Задержать рейс на delay секунд и сдвинуть дальнейшие рейсы того же самолёта.
+ *
+ * Сдвигаются рейсы, вылет которых раньше прибытия предыдущего плюс минимальная стоянка
+ * (если respectGroundTime != 0), в пределах horizon секунд от исходного вылета (0 — без ограничения).
+ * \param apply 0 — только рассчитать сдвиги, иначе применить их к расписанию.
+ * \param changes Массив для сдвигов (первый — задержанный рейс); заполняется не более maxChanges записей.
+ * \param changeCount Полное число сдвинутых рейсов (может быть NULL).
+ * \param conflictBuffer Буфер для номера рейса за горизонтом, с которым остался конфликт (может быть NULL).
+ * \return Код как у Schedule_RescheduleFlight: 0 — без конфликтов, 3/4 — конфликт за горизонтом,
+ *         1 — отрицательная задержка, 6 — рейс не найден.
+ */
+FLIGHT_SCHEDULE_API int Schedule_PropagateDelay(ScheduleHandle handle, const char* flightNumber, long long delay,
+                                                long long horizon, int respectGroundTime, int apply,
+                                                FlightDelayRecord* changes, int maxChanges, int* changeCount,
+                                                char* conflictBuffer, int bufferSize);
+
+/**
+ * \brief Создать и добавить пакет рейсов за один вызов (одно слияние списков, без копирования рейсов).
+ * \return Число добавленных рейсов; statuses[i] — BATCH_ROW_OK, BATCH_ROW_INVALID или BATCH_ROW_DUPLICATE.
+ */
+FLIGHT_SCHEDULE_API int Schedule_AddFlightsBatch(ScheduleHandle handle, const FlightRow* rows, int rowCount,
+                                                 const char* strings, int stringsSize, int* statuses);
+
 FLIGHT_SCHEDULE_API int Schedule_RemoveFlight(ScheduleHandle handle, const char* flightNumber);
-FLIGHT_SCHEDULE_API FlightHandle Schedule_FindFlight(ScheduleHandle handle, const char* flightNumber);
+FLIGHT_SCHEDULE_API FlightHandle Schedule_FindFlight(ScheduleHandle handle, const char* flightNumber); ///< Новый дескриптор рейса из расписания (не копии); освобождается Flight_Destroy
 FLIGHT_SCHEDULE_API int Schedule_IsValid(ScheduleHandle handle);
-FLIGHT_SCHEDULE_API void Schedule_GetValidationErrors(ScheduleHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API int Schedule_GetValidationErrors(ScheduleHandle handle, char* buffer, int bufferSize);
 FLIGHT_SCHEDULE_API void Schedule_ValidateAndFix(ScheduleHandle handle);
-FLIGHT_SCHEDULE_API void Schedule_ToString(ScheduleHandle handle, char* buffer, int bufferSize);
-FLIGHT_SCHEDULE_API void Schedule_GetScheduleForAircraft(ScheduleHandle handle, const char* aircraftId, char* buffer, int bufferSize);
-FLIGHT_SCHEDULE_API void Schedule_GetScheduleForAircraftInRange(ScheduleHandle handle, const char* aircraftId, 
+FLIGHT_SCHEDULE_API int Schedule_ToString(ScheduleHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API int Schedule_GetScheduleForAircraft(ScheduleHandle handle, const char* aircraftId, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API int Schedule_GetScheduleForAircraftInRange(ScheduleHandle handle, const char* aircraftId, 
                                                                  long long startTime, long long endTime, char* buffer, int bufferSize);
-FLIGHT_SCHEDULE_API void Schedule_GetOverdueUrgentCargoReport(ScheduleHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API int Schedule_GetOverdueUrgentCargoReport(ScheduleHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API char* Schedule_GetValidationErrorsAlloc(ScheduleHandle handle);
+FLIGHT_SCHEDULE_API char* Schedule_ToStringAlloc(ScheduleHandle handle);
+FLIGHT_SCHEDULE_API char* Schedule_GetScheduleForAircraftAlloc(ScheduleHandle handle, const char* aircraftId);
+FLIGHT_SCHEDULE_API char* Schedule_GetScheduleForAircraftInRangeAlloc(ScheduleHandle handle, const char* aircraftId,
+                                                                      long long startTime, long long endTime);
+FLIGHT_SCHEDULE_API char* Schedule_GetOverdueUrgentCargoReportAlloc(ScheduleHandle handle);
 FLIGHT_SCHEDULE_API double Schedule_GetTotalFlightTime(ScheduleHandle handle, const char* aircraftId);
 FLIGHT_SCHEDULE_API int Schedule_GetTotalFlights(ScheduleHandle handle);
+FLIGHT_SCHEDULE_API int Schedule_GetFlightNumberAt(ScheduleHandle handle, int index, char* buffer, int bufferSize);
+
+/**
+ * \brief Выгрузить рейсы в столбцы за один проход.
+ * \param columns Массивы столбцов (capacity не меньше Schedule_GetTotalFlights); выходные поля заполняются библиотекой.
+ * \return Число выгруженных строк; -1, если массивы меньше числа рейсов (ничего не записано).
+ */
+FLIGHT_SCHEDULE_API int Schedule_ExportColumns(ScheduleHandle handle, FlightColumns* columns);
+
+/**
+ * \brief Получить все пары конфликтующих рейсов.
+ *
+ * \param pairs Массив из 2 * maxPairs элементов; пара i записывается в pairs[2*i], pairs[2*i+1]
+ *              (индексы рейсов в порядке расписания, см. Schedule_GetFlightNumberAt).
+ * \param maxPairs Вместимость массива в парах.
+ * \return Общее количество конфликтующих пар (может превышать maxPairs; записываются первые maxPairs).
+ */
+FLIGHT_SCHEDULE_API int Schedule_GetConflicts(ScheduleHandle handle, int* pairs, int maxPairs);
+
+/**
+ * \brief Получить все конфликты вместе с их видом.
+ *
+ * \param pairs Как в Schedule_GetConflicts.
+ * \param types Массив из maxPairs элементов: 0 — пересечение, 1 — короткая стоянка, 2 — разрыв маршрута
+ *              (может быть NULL).
+ * \return Общее количество конфликтов.
+ */
+FLIGHT_SCHEDULE_API int Schedule_GetConflictsWithTypes(ScheduleHandle handle, int* pairs, int* types, int maxPairs);
+
+// Правила стоянки (секунды) и маршрута; правило самолёта или аэропорта со значением 0 снимается
+FLIGHT_SCHEDULE_API void Schedule_SetMinGroundTime(ScheduleHandle handle, long long seconds);
+FLIGHT_SCHEDULE_API void Schedule_SetAircraftMinGroundTime(ScheduleHandle handle, const char* aircraftId, long long seconds);
+FLIGHT_SCHEDULE_API void Schedule_SetAirportMinGroundTime(ScheduleHandle handle, const char* airportCode, long long seconds);
+FLIGHT_SCHEDULE_API void Schedule_SetChainCheckEnabled(ScheduleHandle handle, int enabled);
+
+/**
+ * \brief Зафиксировать часы расписания на заданном моменте.
+ *
+ * Все проверки статусов и отчёты расписания используют этот момент вместо системного времени
+ * (для моделирования и воспроизведения прошедших суток).
+ * \param time Момент времени (Unix time).
+ */
+FLIGHT_SCHEDULE_API void Schedule_SetClockTime(ScheduleHandle handle, long long time);
+FLIGHT_SCHEDULE_API void Schedule_UseSystemClock(ScheduleHandle handle);  ///< Вернуть расписанию системные часы
+
+/**
+ * \brief Подключить срочные грузы самолёта (аэропорта) к индексу сроков расписания.
+ *
+ * Грузы, добавленные позже, учитываются автоматически; отчёт Schedule_GetOverdueUrgentCargoReport
+ * перечисляет просроченные грузы всех подключённых самолётов и аэропортов.
+ * Индекс разделяется владением, поэтому порядок уничтожения расписания и самолёта не важен.
+ */
+FLIGHT_SCHEDULE_API void Schedule_RegisterAircraft(ScheduleHandle handle, AircraftHandle aircraft);
+FLIGHT_SCHEDULE_API void Schedule_RegisterAirport(ScheduleHandle handle, AirportHandle airport);
+
+/**
+ * \brief Перевести часы расписания на момент time и поставить наступившие события в очередь.
+ *
+ * Ручные часы (Schedule_SetClockTime) переводятся на time. Системные часы
+ * (Schedule_UseSystemClock) не подменяются: события доставляются до time, а статусы
+ * рейсов и отчёты по-прежнему считаются по системному времени. Доставляются только
+ * события в интервале от предыдущего продвижения до time; при первом вызове отсчёт
+ * начинается с time.
+ * \return Число новых событий в очереди.
+ */
+FLIGHT_SCHEDULE_API int Schedule_AdvanceClock(ScheduleHandle handle, long long time);
+
+/**
+ * \brief Забрать события из очереди (в порядке наступления).
+ *
+ * \param events Массив из maxEvents записей.
+ * \return Число записанных событий (оставшиеся события остаются в очереди).
+ */
+FLIGHT_SCHEDULE_API int Schedule_PollEvents(ScheduleHandle handle, ScheduleEventRecord* events, int maxEvents);
+
+/**
+ * \brief Текущая версия расписания: растёт на единицу с каждым добавлением, удалением,
+ *        переносом, сменой самолёта или завершением рейса.
+ */
+FLIGHT_SCHEDULE_API long long Schedule_GetVersion(ScheduleHandle handle);
+
+/**
+ * \brief Получить изменения после версии version (по возрастанию версий).
+ *
+ * Клиент хранит версию последней применённой записи и повторяет вызов, пока
+ * возвращается maxChanges записей.
+ * \return Число записанных изменений; CHANGES_RESYNC_REQUIRED (-1), если журнал уже не
+ *         содержит всех изменений после version (нужна полная загрузка расписания и версия
+ *         из Schedule_GetVersion); CHANGES_INVALID_ARGUMENT (-2) при неверных аргументах
+ *         или внутренней ошибке.
+ */
+FLIGHT_SCHEDULE_API int Schedule_GetChangesSince(ScheduleHandle handle, long long version,
+                                                 ScheduleChangeRecord* changes, int maxChanges);
+
+// ============================================
+// Cursor API
+// ============================================
+
+/**
+ * \brief Открыть курсор по рейсам расписания в порядке вылета.
+ *
+ * \param aircraftId Только рейсы самолёта (NULL или "" — все самолёты).
+ * \param airportCode Только рейсы с вылетом из аэропорта или прилётом в него (NULL или "" — все аэропорты).
+ * \param startTime Вылет не раньше (0 — без ограничения).
+ * \param endTime Вылет не позже (0 — без ограничения).
+ * \return Курсор или NULL. Курсор закрывается Cursor_Close до Schedule_Destroy.
+ */
+FLIGHT_SCHEDULE_API CursorHandle Schedule_OpenCursor(ScheduleHandle handle, const char* aircraftId, const char* airportCode,
+                                                     long long startTime, long long endTime);
+
+/**
+ * \brief Следующий пакет рейсов: не более maxRecords записей.
+ *
+ * Изменения расписания между вызовами допустимы: обход продолжается с места остановки,
+ * а Cursor_GetVersion сообщает версию расписания, по которой прочитан пакет.
+ * \return Число записей; 0 — рейсы закончились.
+ */
+FLIGHT_SCHEDULE_API int Cursor_Next(CursorHandle cursor, FlightRecord* records, int maxRecords);
+FLIGHT_SCHEDULE_API long long Cursor_GetVersion(CursorHandle cursor);      ///< Версия расписания при последнем пакете (до первого — при открытии)
+FLIGHT_SCHEDULE_API void Cursor_Close(CursorHandle cursor);
 
 // ============================================
 // Flight API
@@ -54,14 +411,14 @@ FLIGHT_SCHEDULE_API int Schedule_GetTotalFlights(ScheduleHandle handle);
 FLIGHT_SCHEDULE_API FlightHandle Flight_Create(const char* number, const char* departure, const char* destination,
                                                 long long depTime, long long arrTime, const char* aircraft);
 FLIGHT_SCHEDULE_API void Flight_Destroy(FlightHandle handle);
-FLIGHT_SCHEDULE_API void Flight_GetFlightNumber(FlightHandle handle, char* buffer, int bufferSize);
-FLIGHT_SCHEDULE_API void Flight_GetDepartureAirport(FlightHandle handle, char* buffer, int bufferSize);
-FLIGHT_SCHEDULE_API void Flight_GetDestinationAirport(FlightHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API int Flight_GetFlightNumber(FlightHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API int Flight_GetDepartureAirport(FlightHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API int Flight_GetDestinationAirport(FlightHandle handle, char* buffer, int bufferSize);
 FLIGHT_SCHEDULE_API long long Flight_GetDepartureTime(FlightHandle handle);
 FLIGHT_SCHEDULE_API long long Flight_GetArrivalTime(FlightHandle handle);
-FLIGHT_SCHEDULE_API void Flight_GetAircraftId(FlightHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API int Flight_GetAircraftId(FlightHandle handle, char* buffer, int bufferSize);
 FLIGHT_SCHEDULE_API int Flight_IsCompleted(FlightHandle handle);
-FLIGHT_SCHEDULE_API void Flight_ToString(FlightHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API int Flight_ToString(FlightHandle handle, char* buffer, int bufferSize);
 FLIGHT_SCHEDULE_API int Flight_IsValid(FlightHandle handle);
 FLIGHT_SCHEDULE_API double Flight_GetFlightDurationHours(FlightHandle handle);
 
@@ -71,13 +428,22 @@ FLIGHT_SCHEDULE_API double Flight_GetFlightDurationHours(FlightHandle handle);
 
 FLIGHT_SCHEDULE_API AircraftHandle Aircraft_Create(const char* number, double maxPayload);
 FLIGHT_SCHEDULE_API void Aircraft_Destroy(AircraftHandle handle);
-FLIGHT_SCHEDULE_API void Aircraft_GetAircraftNumber(AircraftHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API int Aircraft_GetAircraftNumber(AircraftHandle handle, char* buffer, int bufferSize);
 FLIGHT_SCHEDULE_API double Aircraft_GetMaxPayload(AircraftHandle handle);
 FLIGHT_SCHEDULE_API double Aircraft_GetCurrentPayload(AircraftHandle handle);
 FLIGHT_SCHEDULE_API int Aircraft_AddCargo(AircraftHandle handle, CargoHandle cargo);
 FLIGHT_SCHEDULE_API int Aircraft_AddUrgentCargo(AircraftHandle handle, UrgentCargoHandle urgentCargo);
 FLIGHT_SCHEDULE_API int Aircraft_AddPassenger(AircraftHandle handle, PassengerHandle passenger);
-FLIGHT_SCHEDULE_API void Aircraft_ToString(AircraftHandle handle, char* buffer, int bufferSize);
+
+/**
+ * \brief Создать и погрузить пакет грузов (обычных и срочных) за один вызов.
+ * \return Число погруженных грузов; statuses[i] — BATCH_ROW_OK, BATCH_ROW_INVALID или BATCH_ROW_NO_CAPACITY.
+ */
+FLIGHT_SCHEDULE_API int Aircraft_AddCargoBatch(AircraftHandle handle, const CargoRow* rows, int rowCount,
+                                               const char* strings, int stringsSize, int* statuses);
+
+FLIGHT_SCHEDULE_API int Aircraft_ToString(AircraftHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API char* Aircraft_ToStringAlloc(AircraftHandle handle);
 FLIGHT_SCHEDULE_API double Aircraft_GetAvailableCapacity(AircraftHandle handle);
 
 // ============================================
@@ -86,10 +452,19 @@ FLIGHT_SCHEDULE_API double Aircraft_GetAvailableCapacity(AircraftHandle handle);
 
 FLIGHT_SCHEDULE_API AirportHandle Airport_Create(const char* name);
 FLIGHT_SCHEDULE_API void Airport_Destroy(AirportHandle handle);
-FLIGHT_SCHEDULE_API void Airport_GetName(AirportHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API int Airport_GetName(AirportHandle handle, char* buffer, int bufferSize);
 FLIGHT_SCHEDULE_API void Airport_AddAircraft(AirportHandle handle, AircraftHandle aircraft);
 FLIGHT_SCHEDULE_API void Airport_AddCargo(AirportHandle handle, CargoHandle cargo);
-FLIGHT_SCHEDULE_API void Airport_ToString(AirportHandle handle, char* buffer, int bufferSize);
+
+/**
+ * \brief Создать и добавить в аэропорт пакет пассажиров за один вызов.
+ * \return Число добавленных пассажиров; statuses[i] — BATCH_ROW_OK или BATCH_ROW_INVALID.
+ */
+FLIGHT_SCHEDULE_API int Airport_AddPassengersBatch(AirportHandle handle, const PassengerRow* rows, int rowCount,
+                                                   const char* strings, int stringsSize, int* statuses);
+
+FLIGHT_SCHEDULE_API int Airport_ToString(AirportHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API char* Airport_ToStringAlloc(AirportHandle handle);
 
 // ============================================
 // Cargo API
@@ -98,9 +473,9 @@ FLIGHT_SCHEDULE_API void Airport_ToString(AirportHandle handle, char* buffer, in
 FLIGHT_SCHEDULE_API CargoHandle Cargo_Create(const char* number, double mass, const char* departure,
                                               const char* destination, const char* current, long long arrival);
 FLIGHT_SCHEDULE_API void Cargo_Destroy(CargoHandle handle);
-FLIGHT_SCHEDULE_API void Cargo_GetCargoNumber(CargoHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API int Cargo_GetCargoNumber(CargoHandle handle, char* buffer, int bufferSize);
 FLIGHT_SCHEDULE_API double Cargo_GetMass(CargoHandle handle);
-FLIGHT_SCHEDULE_API void Cargo_ToString(CargoHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API int Cargo_ToString(CargoHandle handle, char* buffer, int bufferSize);
 
 // ============================================
 // UrgentCargo API
@@ -111,7 +486,7 @@ FLIGHT_SCHEDULE_API UrgentCargoHandle UrgentCargo_Create(const char* number, dou
                                                           long long arrival, long long deadline);
 FLIGHT_SCHEDULE_API void UrgentCargo_Destroy(UrgentCargoHandle handle);
 FLIGHT_SCHEDULE_API int UrgentCargo_IsOverdue(UrgentCargoHandle handle);
-FLIGHT_SCHEDULE_API void UrgentCargo_ToString(UrgentCargoHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API int UrgentCargo_ToString(UrgentCargoHandle handle, char* buffer, int bufferSize);
 
 // ============================================
 // Passenger API
@@ -120,9 +495,9 @@ FLIGHT_SCHEDULE_API void UrgentCargo_ToString(UrgentCargoHandle handle, char* bu
 FLIGHT_SCHEDULE_API PassengerHandle Passenger_Create(const char* number, const char* name,
                                                       const char* departure, const char* destination);
 FLIGHT_SCHEDULE_API void Passenger_Destroy(PassengerHandle handle);
-FLIGHT_SCHEDULE_API void Passenger_GetPassengerNumber(PassengerHandle handle, char* buffer, int bufferSize);
-FLIGHT_SCHEDULE_API void Passenger_GetName(PassengerHandle handle, char* buffer, int bufferSize);
-FLIGHT_SCHEDULE_API void Passenger_ToString(PassengerHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API int Passenger_GetPassengerNumber(PassengerHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API int Passenger_GetName(PassengerHandle handle, char* buffer, int bufferSize);
+FLIGHT_SCHEDULE_API int Passenger_ToString(PassengerHandle handle, char* buffer, int bufferSize);
 
 #ifdef __cplusplus
 }
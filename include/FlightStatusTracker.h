@@ -0,0 +1,57 @@
+//! \file FlightStatusTracker.h
+//! \brief Разбиение рейсов по статусам (запланирован, в полёте, прибыл, завершён) с продвигаемыми часами.
+
+#ifndef FLIGHT_STATUS_TRACKER_H
+#define FLIGHT_STATUS_TRACKER_H
+
+#include <ctime>
+#include <map>
+#include "Flight.h"
+
+/**
+ * @class FlightStatusTracker
+ * @brief Счётчики статусов рейсов относительно текущего момента
+ *
+ * Незавершённые рейсы хранятся в двух упорядоченных разделах: запланированные
+ * (по времени вылета) и находящиеся в полёте (по времени прибытия). При
+ * продвижении часов вперёд рейсы переходят между разделами с их начала, поэтому
+ * стоимость advanceTo() пропорциональна числу сменивших статус рейсов, а счётчики
+ * читаются за O(1). При переводе часов назад разделы перестраиваются.
+ *
+ * Статусы совпадают с Flight::isScheduled() и Flight::isInProgress():
+ * рейс запланирован, если now < вылета, и в полёте, если вылет <= now <= прибытие.
+ * Рейсы хранятся по указателю: время и флаг завершения рейса нужно менять,
+ * предварительно убрав рейс из трекера (remove), и возвращать его после (add).
+ */
+class FlightStatusTracker {
+private:
+    std::time_t now;                                          ///< Текущий момент часов трекера
+    std::multimap<std::time_t, const Flight*> scheduled;      ///< Запланированные рейсы по времени вылета
+    std::multimap<std::time_t, const Flight*> inProgress;     ///< Рейсы в полёте по времени прибытия
+    std::multimap<std::time_t, const Flight*> arrived;        ///< Прибывшие, но не завершённые рейсы по времени прибытия
+    int completedCount;                                       ///< Число завершённых рейсов
+    
+    static bool eraseFrom(std::multimap<std::time_t, const Flight*>& partition, std::time_t key, const Flight* flight); ///< Убрать рейс из раздела
+    void place(const Flight* flight);                         ///< Поместить рейс в раздел по текущему моменту
+
+public:
+    /**
+     * @brief Создать пустой трекер
+     * @param now Начальный момент часов (Unix time)
+     */
+    explicit FlightStatusTracker(std::time_t now = 0);
+    
+    void add(const Flight* flight);                           ///< Учесть рейс
+    void remove(const Flight* flight);                        ///< Перестать учитывать рейс
+    void clear();                                             ///< Убрать все рейсы (момент часов сохраняется)
+    
+    void advanceTo(std::time_t time);                         ///< Перевести часы и обновить разделы
+    std::time_t getTime() const;                              ///< Текущий момент часов
+    
+    int getScheduledCount() const;                            ///< Число запланированных рейсов
+    int getInProgressCount() const;                           ///< Число рейсов в полёте
+    int getArrivedCount() const;                              ///< Число прибывших, но не завершённых рейсов
+    int getCompletedCount() const;                            ///< Число завершённых рейсов
+};
+
+#endif // FLIGHT_STATUS_TRACKER_H
@@ -0,0 +1,66 @@
+//! \file LocalTimeCache.h
+//! \brief Кэш смещений местного времени от UTC для разбиения интервалов по местным суткам.
+
+#ifndef LOCAL_TIME_CACHE_H
+#define LOCAL_TIME_CACHE_H
+
+#include <ctime>
+#include <vector>
+
+/**
+ * @class LocalTimeCache
+ * @brief Номера местных суток и местные полуночи без вызова localtime_s на каждый запрос
+ *
+ * При создании для каждых суток UTC в заданном диапазоне один раз вычисляется
+ * смещение местного времени и момент его смены (переход на летнее/зимнее время),
+ * после чего запросы выполняются за O(1) целочисленной арифметикой. Вне диапазона
+ * смещение вычисляется напрямую. Диапазон расширяется методом cover(); пока он
+ * не вызывается, объект только читается и его можно использовать из нескольких
+ * потоков одновременно.
+ *
+ * Кэш непрерывен, поэтому момент далеко за его границей (рейс через годы после
+ * остальных, ошибочная метка времени) потребовал бы заполнить все сутки до него.
+ * cover() не расширяет кэш больше чем на MAX_EXTENSION_DAYS суток за вызов:
+ * такие выбросы остаются вне кэша и вычисляются напрямую.
+ */
+class LocalTimeCache {
+private:
+    //! Местное время в пределах одних суток UTC
+    struct DayOffsets {
+        long offsetAtStart;        ///< Смещение от UTC в начале суток, секунды
+        std::time_t transition;    ///< Момент смены смещения (начало следующих суток, если смены нет)
+        long offsetAfter;          ///< Смещение после смены
+        long long localDayAtStart; ///< Номер местных суток в начале суток UTC
+        std::time_t midnight;      ///< Местная полночь в (начало, конец] суток UTC (конец суток, если её нет)
+        long long localDayAfter;   ///< Номер местных суток после полуночи
+    };
+    
+    long long firstUtcDay;        ///< Номер первых суток UTC в кэше
+    std::vector<DayOffsets> days; ///< Сведения по суткам UTC, начиная с firstUtcDay
+    
+    static long computeOffset(std::time_t time);               ///< Смещение от UTC через localtime_s
+    static std::time_t computeNextLocalMidnight(std::time_t time); ///< Местная полночь после time через localtime_s
+    static DayOffsets computeDay(long long utcDay);             ///< Сведения о сутках UTC через localtime_s
+    const DayOffsets* findDay(std::time_t time) const;         ///< Сутки UTC из кэша (nullptr вне диапазона)
+
+public:
+    static const long DAY_SECONDS = 24 * 60 * 60; ///< Длительность суток в секундах
+    static const long long MAX_EXTENSION_DAYS = 4 * 366; ///< Наибольшее число суток, добавляемых одним вызовом cover()
+    
+    LocalTimeCache(); ///< Пустой кэш (все запросы вычисляются напрямую до вызова cover())
+    
+    /**
+     * @brief Заполнить кэш для моментов из [from, to]
+     * @param from Начало диапазона (Unix time)
+     * @param to Конец диапазона (Unix time)
+     */
+    LocalTimeCache(std::time_t from, std::time_t to);
+    
+    bool cover(std::time_t from, std::time_t to);          ///< Расширить кэш до [from, to] (false, если нужно больше MAX_EXTENSION_DAYS суток)
+    
+    long getUtcOffset(std::time_t time) const;             ///< Смещение местного времени от UTC, секунды
+    long long getLocalDay(std::time_t time) const;         ///< Номер местных суток (0 — 1970-01-01 по местному времени)
+    std::time_t getNextLocalMidnight(std::time_t time) const; ///< Ближайшая местная полночь строго после time
+};
+
+#endif // LOCAL_TIME_CACHE_H
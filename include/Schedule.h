@@ -8,58 +8,267 @@
 #include <memory>
 #include <string>
 #include <ctime>
+#include <unordered_map>
+#include <set>
+#include <deque>
+#include <cstdint>
+#include <functional>
+#include <mutex>
 #include "Flight.h"
+#include "LocalTimeCache.h"
+#include "FlightStatusTracker.h"
+#include "Clock.h"
+#include "CargoDeadlineIndex.h"
+#include "EventEngine.h"
+#include "Aircraft.h"
+#include "Airport.h"
+
+//! Вид конфликта между рейсами одного самолёта.
+enum class ConflictType {
+    Overlap = 0,     ///< Интервалы полётов пересекаются
+    Turnaround = 1,  ///< Стоянка между последовательными рейсами короче минимальной
+    Chain = 2        ///< Следующий рейс вылетает не из аэропорта прибытия предыдущего
+};
+
+//! Пара конфликтующих рейсов: индексы в Schedule::getFlights(), first < second.
+struct FlightConflict {
+    size_t first;   ///< Индекс рейса, стоящего раньше в расписании
+    size_t second;  ///< Индекс рейса, стоящего позже в расписании
+    ConflictType type = ConflictType::Overlap; ///< Вид конфликта
+};
+
+//! Результат проверки рейса перед добавлением в расписание.
+enum class FlightCheckStatus {
+    Ok = 0,               ///< Рейс можно добавить
+    InvalidFlight = 1,    ///< Рейс отсутствует или некорректен (Flight::isValid)
+    DuplicateNumber = 2,  ///< Номер рейса уже занят
+    Overlap = 3,          ///< Пересечение с рейсом того же самолёта
+    Turnaround = 4,       ///< Стоянка до или после соседнего рейса короче минимальной
+    Chain = 5,            ///< Разрыв маршрута с соседним рейсом (при включённой проверке)
+    NotFound = 6          ///< Рейс с таким номером не найден (перенос и смена самолёта)
+};
+
+//! Причина отказа в добавлении рейса.
+struct FlightCheckResult {
+    FlightCheckStatus status;       ///< Итог проверки
+    std::string conflictingFlight;  ///< Номер соседнего рейса, с которым найден конфликт
+};
+
+//! Вид изменения в журнале расписания.
+enum class ScheduleChangeType {
+    Added = 0,        ///< Рейс добавлен
+    Removed = 1,      ///< Рейс удалён
+    Rescheduled = 2,  ///< Изменено время вылета и прибытия
+    Reassigned = 3,   ///< Рейс передан другому самолёту
+    Completed = 4     ///< Рейс завершён
+};
+
+//! Запись журнала изменений: рейс после изменения (для удалённого — перед удалением).
+struct ScheduleChange {
+    std::uint64_t version;          ///< Версия расписания после изменения
+    ScheduleChangeType type;        ///< Вид изменения
+    std::string flightNumber;       ///< Номер рейса
+    std::string departureAirport;   ///< Аэропорт вылета
+    std::string destinationAirport; ///< Аэропорт назначения
+    std::string aircraftId;         ///< Бортовой номер самолёта
+    std::time_t departureTime;      ///< Время вылета
+    std::time_t arrivalTime;        ///< Время прибытия
+    bool completed;                 ///< Рейс завершён
+};
+
+//! Налёт самолёта в скользящих окнах (часы, по рейсам с вылетом в окне).
+struct AircraftFlightHours {
+    std::string aircraftId; ///< Бортовой номер самолёта
+    double last24Hours;     ///< Налёт за последние 24 часа
+    double last7Days;       ///< Налёт за последние 7 суток
+    double last28Days;      ///< Налёт за последние 28 суток
+};
+
+//! Невладеющее представление непрерывного участка упорядоченного списка рейсов.
+//! Действительно, пока расписание не изменяется (добавление, удаление, исправление).
+class FlightRange {
+public:
+    using const_iterator = std::vector<std::shared_ptr<Flight>>::const_iterator; ///< Итератор по рейсам участка
+
+private:
+    const_iterator first; ///< Первый рейс участка
+    const_iterator last;  ///< Позиция за последним рейсом участка
+
+public:
+    FlightRange(const_iterator first, const_iterator last) : first(first), last(last) {}
+    
+    const_iterator begin() const { return first; }                 ///< Начало участка
+    const_iterator end() const { return last; }                    ///< Конец участка
+    size_t size() const { return static_cast<size_t>(last - first); } ///< Число рейсов в участке
+    bool empty() const { return first == last; }                   ///< Участок пуст
+    const std::shared_ptr<Flight>& operator[](size_t index) const { return first[index]; } ///< Рейс по индексу в участке
+};
 
 //! Расписание: список рейсов, упорядоченный по времени вылета; проверка конфликтов и корректности.
 class Schedule {
+public:
+    using FlightList = std::vector<std::shared_ptr<Flight>>; ///< Список рейсов, упорядоченный по времени отправления
+    using OverworkCallback = std::function<void(const std::string& aircraftId, bool overworked)>; ///< Уведомление: самолёт стал или перестал быть перегруженным
+    
+    static const long long MAX_DAILY_FLIGHT_TIME = 12 * 60 * 60; ///< Лимит налёта за местные сутки, секунды
+    static const size_t DEFAULT_CHANGE_LOG_LIMIT = 100000;       ///< Число записей журнала изменений по умолчанию
+
 private:
-    std::vector<std::shared_ptr<Flight>> flights;  ///< Список рейсов (упорядоченный по времени отправления)
+    //! Налёт самолёта по местным суткам
+    struct DutyDays {
+        std::unordered_map<long long, long long> daySeconds; ///< Секунды полёта по номеру местных суток
+        int overworkedDays = 0;                              ///< Число суток сверх MAX_DAILY_FLIGHT_TIME
+    };
+    
+
+    FlightList flights;                              ///< Список рейсов (упорядоченный по времени отправления)
+    std::unordered_map<std::string, std::shared_ptr<Flight>> flightIndex; ///< Индекс рейсов по номеру (номера уникальны)
+    std::unordered_map<std::string, FlightList> aircraftFlights; ///< Рейсы каждого самолёта (по времени отправления)
+    std::unordered_map<std::string, FlightList> airportFlights;  ///< Рейсы каждого аэропорта: вылет или прилёт (по времени отправления)
+    std::unordered_map<std::string, std::vector<long long>> aircraftFlightSeconds; ///< Накопленные секунды полётов по списку самолёта (n + 1 элемент)
+    
+    LocalTimeCache localTime;                        ///< Кэш местного времени для разбиения рейсов по суткам
+    std::unordered_map<std::string, DutyDays> aircraftDuty; ///< Налёт каждого самолёта по местным суткам
+    std::set<std::string> overworkedAircraft;        ///< Самолёты с превышением суточного лимита (по бортовому номеру)
+    OverworkCallback overworkCallback;               ///< Уведомление об изменении набора перегруженных самолётов
+    std::shared_ptr<const Clock> clock;              ///< Источник текущего времени (по умолчанию системные часы)
+    std::shared_ptr<CargoDeadlineIndex> cargoDeadlines; ///< Индекс сроков срочных грузов зарегистрированных самолётов и аэропортов
+    mutable FlightStatusTracker statusTracker;       ///< Статусы рейсов (часы продвигаются при чтении счётчиков)
+    mutable std::mutex statusMutex;                  ///< Продвижение трекера в константных счётчиках (читатели параллельны)
+    std::unique_ptr<EventEngine> events;             ///< Движок событий (создаётся при первом обращении)
+    std::unordered_map<const Flight*, std::pair<EventEngine::TimerId, EventEngine::TimerId>> flightTimers; ///< Таймеры вылета и прибытия рейсов
+    
+    std::time_t minGroundTime;                       ///< Минимальное время стоянки между рейсами самолёта (по умолчанию 0)
+    std::unordered_map<std::string, std::time_t> aircraftGroundTime; ///< Минимальная стоянка отдельных самолётов
+    std::unordered_map<std::string, std::time_t> airportGroundTime;  ///< Минимальная стоянка в отдельных аэропортах
+    bool chainCheckEnabled;                          ///< Проверять ли непрерывность маршрута самолёта
+    
+    std::uint64_t version;                           ///< Версия расписания: растёт на единицу с каждым изменением рейсов
+    std::deque<ScheduleChange> changeLog;            ///< Журнал последних изменений (версии подряд, последняя — version)
+    size_t changeLogLimit;                           ///< Наибольшее число записей журнала (0 — журнал не ведётся)
+    
+    static const std::time_t DAY_SECONDS = 24 * 60 * 60; ///< Длительность суток в секундах
     
     // Вспомогательные методы
     void sortFlights();                              ///< Отсортировать рейсы по времени отправления
+    void rebuildIndexes();                           ///< Перестроить индексы по списку рейсов
+    void indexFlight(const std::shared_ptr<Flight>& flight);   ///< Добавить рейс в индексы самолётов и аэропортов
+    void unindexFlight(const std::shared_ptr<Flight>& flight); ///< Убрать рейс из индексов самолётов и аэропортов
+    void addToAircraftList(const std::shared_ptr<Flight>& flight);      ///< Добавить рейс в список самолёта и накопленные суммы
+    void removeFromAircraftList(const std::shared_ptr<Flight>& flight); ///< Убрать рейс из списка самолёта и накопленных сумм
+    void rebuildFlightSeconds(const std::string& aircraftId);  ///< Пересчитать накопленные секунды полётов самолёта
+    void updateDuty(const Flight& flight, int sign);            ///< Учесть рейс в суточном налёте (+1 добавить, -1 убрать)
+    void recordChange(ScheduleChangeType type, const Flight& flight); ///< Увеличить версию и записать изменение в журнал
+    void resetChangeLog();                           ///< Начать журнал заново (клиентам с более старой версией нужна полная загрузка)
+    void rebuildDuty();                                         ///< Пересчитать суточный налёт всех самолётов
+    static void accumulateDuty(const FlightList& aircraftFlights, const LocalTimeCache& calendar,
+                               std::vector<std::pair<long long, long long>>& buffer, DutyDays& duty); ///< Суточный налёт одного самолёта
+    long long flightSecondsInRange(const std::string& aircraftId, std::time_t startTime, std::time_t endTime) const; ///< Секунды полётов с вылетом в диапазоне
+    size_t getFlightPosition(const Flight* flight) const;      ///< Индекс рейса в списке getFlights()
+    const FlightList& getFlightsByAircraftRef(const std::string& aircraftId) const; ///< Рейсы самолёта без копирования
+    FlightRange aircraftFlightsInRange(const std::string& aircraftId, std::time_t startTime, std::time_t endTime) const; ///< Рейсы самолёта с вылетом в диапазоне
+    EventEngine& ensureEvents(std::time_t start);    ///< Создать движок событий с часами на start и поставить таймеры всех рейсов
+    void scheduleFlightEvents(const std::shared_ptr<Flight>& flight); ///< Поставить таймеры вылета и прибытия рейса
+    void cancelFlightEvents(const Flight* flight);   ///< Отменить таймеры рейса
     bool hasConflicts() const;                       ///< Проверить наличие конфликтов в расписании
+    bool hasConflictsInGroup(const std::string& aircraftId, const std::vector<const Flight*>& group) const; ///< Проверить конфликты среди рейсов одного самолёта
+    std::time_t aircraftMinGroundTime(const std::string& aircraftId) const; ///< Стоянка самолёта без учёта аэропорта
+    bool violatesSequence(const Flight& previous, const Flight& next, std::time_t groundTime, ConflictType& type) const; ///< Проверить стоянку и маршрут соседних рейсов
+    FlightCheckResult checkNeighbours(const Flight* previous, const Flight& flight,
+                                      const Flight* following) const; ///< Проверить рейс с предшественником и преемником по самолёту (nullptr — нет соседа)
 
 public:
     // Конструкторы
     Schedule();
-    Schedule(const Schedule& other);
+    Schedule(const Schedule& other);                 ///< Копия с собственными объектами рейсов
     
     // Оператор присваивания
-    Schedule& operator=(const Schedule& other);
+    Schedule& operator=(const Schedule& other);      ///< Присвоить копии рейсов other
     
     // Деструктор
     ~Schedule();
     
     // Основные методы
-    void addFlight(std::shared_ptr<Flight> flight);  ///< Добавить рейс в расписание
+    bool addFlight(std::shared_ptr<Flight> flight);  ///< Добавить рейс (false, если рейс некорректен или номер уже занят); O(n), для загрузки — addFlights
+    int addFlights(const std::vector<std::shared_ptr<Flight>>& newFlights,
+                   std::vector<FlightCheckStatus>* statuses = nullptr); ///< Добавить несколько рейсов (одно слияние), вернуть число добавленных; statuses — итог по каждому рейсу
     void removeFlight(const std::string& flightNumber); ///< Удалить рейс из расписания
-    std::shared_ptr<Flight> findFlight(const std::string& flightNumber) const; ///< Найти рейс по номеру
+    FlightCheckResult checkFlight(const Flight& flight) const; ///< Проверить рейс на конфликты с соседями по самолёту (O(log n))
+    FlightCheckResult tryAddFlight(std::shared_ptr<Flight> flight); ///< Добавить рейс, только если checkFlight не нашёл конфликтов
+    FlightCheckResult rescheduleFlight(const std::string& flightNumber, std::time_t newDeparture, std::time_t newArrival,
+                                       bool rejectConflicts = true); ///< Перенести рейс с сохранением порядка (при конфликте и rejectConflicts не меняется)
+    FlightCheckResult reassignAircraft(const std::string& flightNumber,
+                                       const std::string& newAircraftId); ///< Передать рейс другому самолёту (при конфликте не меняется)
+    std::shared_ptr<Flight> findFlight(const std::string& flightNumber) const; ///< Найти рейс по номеру (номер, время, самолёт и статус следует менять только через Schedule)
     
     // Методы для работы с расписанием
     bool isValid() const;                            ///< Проверить корректность расписания
     std::vector<std::string> getValidationErrors() const; ///< Получить список ошибок валидации
     void validateAndFix();                          ///< Проверить и исправить ошибки в расписании
+    std::vector<FlightConflict> getConflicts() const; ///< Получить все конфликты: пересечения, короткие стоянки, разрывы маршрута
+    
+    // Правила стоянки и маршрута (учитываются в isValid и getConflicts)
+    void setMinGroundTime(std::time_t seconds);      ///< Минимальная стоянка между рейсами любого самолёта
+    std::time_t getMinGroundTime() const;            ///< Получить минимальную стоянку по умолчанию
+    void setAircraftMinGroundTime(const std::string& aircraftId, std::time_t seconds); ///< Минимальная стоянка самолёта (0 — снять)
+    void setAirportMinGroundTime(const std::string& airportCode, std::time_t seconds);  ///< Минимальная стоянка в аэропорту (0 — снять)
+    std::time_t getRequiredGroundTime(const std::string& aircraftId, const std::string& airportCode) const; ///< Действующая стоянка (максимум из правил)
+    void setChainCheckEnabled(bool enabled);         ///< Требовать вылет из аэропорта прибытия предыдущего рейса
+    bool isChainCheckEnabled() const;                ///< Включена ли проверка маршрута
     
     // Методы для получения информации
     const std::vector<std::shared_ptr<Flight>>& getFlights() const; ///< Получить список всех рейсов
     std::vector<std::shared_ptr<Flight>> getFlightsByAircraft(const std::string& aircraftId) const; ///< Получить рейсы самолёта
+    FlightRange getFlightsByAircraftInRange(const std::string& aircraftId, std::time_t startTime,
+                                            std::time_t endTime) const; ///< Рейсы самолёта с вылетом в [startTime, endTime] без копирования (O(log n))
     std::vector<std::shared_ptr<Flight>> getFlightsByAirport(const std::string& airportCode) const; ///< Получить рейсы аэропорта
-    std::vector<std::shared_ptr<Flight>> getFlightsInTimeRange(std::time_t startTime, std::time_t endTime) const; ///< Получить рейсы в временном диапазоне
+    FlightRange getFlightsByAirportInRange(const std::string& airportCode, std::time_t startTime,
+                                           std::time_t endTime) const; ///< Рейсы аэропорта с вылетом в [startTime, endTime] без копирования (O(log n))
+    FlightRange getFlightsInTimeRange(std::time_t startTime, std::time_t endTime) const; ///< Рейсы с вылетом в [startTime, endTime] без копирования (O(log n))
     
     // Методы для анализа времени полётов
     double getTotalFlightTime(const std::string& aircraftId) const; ///< Получить общее время полётов самолёта
     double getTotalFlightTimeInRange(const std::string& aircraftId, std::time_t startTime, std::time_t endTime) const; ///< Получить время полётов в диапазоне
-    std::vector<std::string> getOverworkedAircraft() const; ///< Получить список перегруженных самолётов
+    std::vector<std::string> getOverworkedAircraft() const; ///< Получить список перегруженных самолётов (O(число перегруженных))
+    bool isOverworked(const std::string& aircraftId) const; ///< Превышен ли суточный лимит налёта самолёта
+    void recalculateOverwork();                      ///< Пересчитать суточный налёт всех самолётов заново (O(n))
+    double getDailyFlightHours(const std::string& aircraftId, std::time_t time) const; ///< Налёт самолёта за местные сутки, содержащие time
+    void setOverworkCallback(OverworkCallback callback); ///< Установить уведомление о перегрузке самолётов
+    void setClock(std::shared_ptr<const Clock> newClock); ///< Установить источник времени (nullptr — системные часы)
+    std::shared_ptr<const Clock> getClock() const;   ///< Получить источник времени
+    AircraftFlightHours getRollingFlightHours(const std::string& aircraftId, std::time_t now) const; ///< Налёт самолёта за 24 ч, 7 и 28 суток до now
+    std::vector<AircraftFlightHours> getFleetRollingFlightHours(std::time_t now) const; ///< Скользящий налёт всех самолётов (по бортовому номеру)
     
     // Методы для вывода расписания
     std::string toString() const;                    ///< Получить строковое представление всего расписания
     std::string getScheduleForAircraft(const std::string& aircraftId) const; ///< Получить расписание для самолёта
     std::string getScheduleForAircraftInRange(const std::string& aircraftId, std::time_t startTime, std::time_t endTime) const; ///< Получить расписание самолёта в диапазоне
-    std::string getOverdueUrgentCargoReport() const; ///< Получить отчёт о просроченных срочных грузах
+    std::string getOverdueUrgentCargoReport() const; ///< Получить отчёт о просроченных срочных грузах (по сроку)
+    
+    // Методы для работы со срочными грузами сети
+    void registerAircraft(std::shared_ptr<Aircraft> aircraft); ///< Подключить грузы самолёта к индексу сроков
+    void registerAirport(std::shared_ptr<Airport> airport);    ///< Подключить грузы аэропорта к индексу сроков
+    std::vector<CargoDeadlineEntry> getOverdueUrgentCargo() const; ///< Просроченные грузы сети (O(log n + k), по сроку)
+    std::vector<CargoDeadlineEntry> getUrgentCargo() const;        ///< Грузы сети со сроком в ближайшие 24 ч, включая просроченные
+    std::shared_ptr<CargoDeadlineIndex> getCargoDeadlineIndex() const; ///< Получить индекс сроков грузов сети
+    
+    // События расписания (вылеты, прибытия, просрочка грузов)
+    void addEventListener(EventEngine::EventCallback callback); ///< Добавить получателя пакетов событий
+    size_t processEvents();                          ///< Доставить события, наступившие к текущему моменту часов, вернуть их число
+    size_t processEvents(std::time_t now);           ///< Доставить события, наступившие к моменту now (часы расписания не меняются)
+    EventEngine& getEventEngine();                   ///< Получить движок событий (очередь для опроса, таймеры)
+    EventEngine& getEventEngine(std::time_t start);  ///< Получить движок событий; при первом обращении его часы начинаются с start
     
     // Методы для работы с рейсами
     void completeFlight(const std::string& flightNumber); ///< Завершить рейс
-    void addReturnFlights();                        ///< Добавить обратные рейсы для всех прямых рейсов
+    int addReturnFlights(bool rejectConflicts = false); ///< Добавить обратные рейсы (при rejectConflicts — только без пересечений), вернуть число добавленных
+    
+    // Журнал изменений для инкрементальной синхронизации
+    std::uint64_t getVersion() const;               ///< Текущая версия расписания
+    bool getChangesSince(std::uint64_t sinceVersion, std::vector<ScheduleChange>& changes,
+                         size_t maxChanges = SIZE_MAX) const; ///< Изменения после версии (false, если журнал уже не содержит их все)
+    void setChangeLogLimit(size_t limit);           ///< Наибольшее число хранимых записей журнала
+    size_t getChangeLogLimit() const;               ///< Получить ограничение журнала
     
     // Статистические методы
     int getTotalFlights() const;                    ///< Получить общее количество рейсов
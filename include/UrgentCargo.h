@@ -33,12 +33,17 @@ public:
     
     // Специфичные методы для срочного груза
     bool isOverdue() const;  ///< Проверить, просрочен ли груз
+    bool isOverdue(std::time_t now) const;  ///< Проверить, просрочен ли груз на момент now
     bool isUrgent() const;   ///< Проверить, является ли груз срочным
+    bool isUrgent(std::time_t now) const;   ///< Проверить, является ли груз срочным на момент now
     int getDaysUntilDeadline() const;  ///< Получить количество дней до крайнего срока
+    int getDaysUntilDeadline(std::time_t now) const;  ///< Получить количество дней до крайнего срока от момента now
     
     // Переопределение методов базового класса
     std::string toString() const override;
+    std::string toString(std::time_t now) const;  ///< Строковое представление с признаками срочности на момент now
     bool isValid() const override;
+    bool isValid(std::time_t now) const;  ///< Проверить корректность (крайний срок позже now)
     
     // Операторы сравнения (по массе, как в базовом классе)
     bool operator==(const UrgentCargo& other) const;
@@ -0,0 +1,57 @@
+//! \file UrgentCargoRegistry.h
+//! \brief Срочные грузы самолёта или аэропорта: список, локальный индекс сроков и записи в общем индексе сети.
+
+#ifndef URGENT_CARGO_REGISTRY_H
+#define URGENT_CARGO_REGISTRY_H
+
+#include <ctime>
+#include <memory>
+#include <string>
+#include <vector>
+#include "UrgentCargo.h"
+#include "CargoDeadlineIndex.h"
+
+/**
+ * @class UrgentCargoRegistry
+ * @brief Срочные грузы одного местонахождения
+ *
+ * Держит список грузов, их локальный индекс сроков и, если подключён общий индекс
+ * сети, записи в нём с местонахождением для отчётов (например, "Aircraft A1").
+ * Владельцем записей в общем индексе считается сам реестр, поэтому он удаляет их
+ * при уничтожении. Копия получает грузы и местонахождение, но не подключение к сети.
+ */
+class UrgentCargoRegistry {
+private:
+    std::string location;                                 ///< Местонахождение грузов в общем индексе
+    std::vector<std::shared_ptr<UrgentCargo>> cargoList;  ///< Срочные грузы в порядке добавления
+    CargoDeadlineIndex deadlines;                         ///< Грузы по крайнему сроку
+    std::shared_ptr<CargoDeadlineIndex> network;          ///< Общий индекс сроков сети (если подключён)
+
+    void attach();                                        ///< Внести все грузы в общий индекс
+    void detach();                                        ///< Убрать все грузы из общего индекса
+
+public:
+    /**
+     * @brief Создать пустой реестр
+     * @param location Местонахождение грузов для общего индекса
+     */
+    explicit UrgentCargoRegistry(const std::string& location = "");
+    UrgentCargoRegistry(const UrgentCargoRegistry& other);            ///< Копия без подключения к сети
+    UrgentCargoRegistry& operator=(const UrgentCargoRegistry& other); ///< Присвоить грузы other (подключение сохраняется)
+    ~UrgentCargoRegistry();
+
+    void add(std::shared_ptr<UrgentCargo> cargo);         ///< Учесть груз в списке и индексах сроков
+    void remove(const std::string& cargoNumber);          ///< Убрать грузы с данным номером
+    void clear();                                         ///< Убрать все грузы
+    std::shared_ptr<UrgentCargo> find(const std::string& cargoNumber) const; ///< Груз по номеру (nullptr, если нет)
+    const std::vector<std::shared_ptr<UrgentCargo>>& getList() const; ///< Грузы в порядке добавления
+
+    std::vector<std::shared_ptr<UrgentCargo>> getOverdue(std::time_t now) const; ///< Просроченные на момент now (по сроку)
+    std::vector<std::shared_ptr<UrgentCargo>> getUrgent(std::time_t now) const;  ///< Срочные на момент now (по сроку)
+
+    void setLocation(const std::string& newLocation);     ///< Сменить местонахождение (записи общего индекса обновляются)
+    void setNetworkIndex(std::shared_ptr<CargoDeadlineIndex> index); ///< Подключить общий индекс (nullptr — отключить)
+    std::shared_ptr<CargoDeadlineIndex> getNetworkIndex() const;     ///< Подключённый общий индекс
+};
+
+#endif // URGENT_CARGO_REGISTRY_H
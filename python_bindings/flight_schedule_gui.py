@@ -19,7 +19,7 @@ sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
 
 try:
     from flight_schedule_lib import (
-        Schedule, Flight, Aircraft, Airport, Cargo, UrgentCargo, Passenger
+        Schedule, Flight, Aircraft, Airport, Cargo, UrgentCargo, Passenger, CHANGE_REMOVED
     )
 except ImportError as e:
     messagebox.showerror("Ошибка", f"Не удалось загрузить библиотеку: {e}\n"
@@ -48,6 +48,11 @@ class FlightScheduleGUI:
         self.aircrafts = {}
         self.airports = {}
         
+        # Синхронизация с журналом изменений расписания
+        self.flights_version = 0        # Версия, до которой применены изменения в списке рейсов
+        self.flight_items = {}          # Номер рейса -> строка в списке рейсов
+        self.schedule_text_version = -1 # Версия, для которой построен текст расписания
+        
         # Создаём интерфейс
         self.create_widgets()
         
@@ -102,7 +107,7 @@ class FlightScheduleGUI:
         control_frame = ttk.Frame(frame)
         control_frame.pack(fill=tk.X, padx=5, pady=5)
         
-        ttk.Button(control_frame, text="Обновить", command=self.refresh_schedule).pack(side=tk.LEFT, padx=2)
+        ttk.Button(control_frame, text="Обновить", command=lambda: self.refresh_schedule(force=True)).pack(side=tk.LEFT, padx=2)
         ttk.Button(control_frame, text="Проверить валидность", command=self.validate_schedule).pack(side=tk.LEFT, padx=2)
         ttk.Button(control_frame, text="Исправить ошибки", command=self.fix_schedule).pack(side=tk.LEFT, padx=2)
         
@@ -422,8 +427,7 @@ class FlightScheduleGUI:
             flight2 = Flight("FL-002", "Домодедово", "Внуково",
                            now + timedelta(hours=3), now + timedelta(hours=4), "A-002")
             
-            self.schedule.add_flight(flight1)
-            self.schedule.add_flight(flight2)
+            self.schedule.add_flights([flight1, flight2])
             
             self.refresh_schedule()
             self.refresh_flights()
@@ -431,12 +435,16 @@ class FlightScheduleGUI:
         except Exception as e:
             messagebox.showwarning("Предупреждение", f"Ошибка при загрузке тестовых данных: {e}")
     
-    def refresh_schedule(self):
-        """Обновить отображение расписания"""
+    def refresh_schedule(self, force: bool = False):
+        """Обновить отображение расписания (без force — только если расписание изменилось)"""
         try:
+            version = self.schedule.get_version()
+            if not force and version == self.schedule_text_version:
+                return
             schedule_text = self.schedule.to_string()
             self.schedule_text.delete(1.0, tk.END)
             self.schedule_text.insert(1.0, schedule_text)
+            self.schedule_text_version = version
         except Exception as e:
             messagebox.showerror("Ошибка", f"Не удалось обновить расписание: {e}")
     
@@ -490,20 +498,48 @@ class FlightScheduleGUI:
                 self.refresh_flights()
                 self.refresh_schedule()
             else:
-                messagebox.showerror("Ошибка", "Не удалось добавить рейс!")
+                messagebox.showerror("Ошибка", "Не удалось добавить рейс! "
+                                     "Проверьте данные: номер рейса должен быть уникальным.")
         except ValueError as e:
             messagebox.showerror("Ошибка", f"Неверный формат даты/времени: {e}")
         except Exception as e:
             messagebox.showerror("Ошибка", f"Не удалось добавить рейс: {e}")
     
     def refresh_flights(self):
-        """Обновить список рейсов"""
-        # Очищаем дерево
-        for item in self.flights_tree.get_children():
-            self.flights_tree.delete(item)
+        """Обновить список рейсов по журналу изменений расписания"""
+        changes = self.schedule.get_changes_since(self.flights_version)
+        if changes is None:
+            # Журнал уже не содержит всех изменений: загружаем список заново через курсор
+            for item in self.flights_tree.get_children():
+                self.flights_tree.delete(item)
+            self.flight_items.clear()
+            self.flights_version = self.schedule.get_version()
+            for flight in self.schedule.iter_flights():
+                values = (flight['flight_number'], flight['departure_airport'], flight['destination_airport'],
+                               flight['departure_time'].strftime("%Y-%m-%d %H:%M"),
+                               flight['arrival_time'].strftime("%Y-%m-%d %H:%M"),
+                               flight['aircraft_id'])
+                self.flight_items[flight['flight_number']] = self.flights_tree.insert("", tk.END, values=values)
+            return
         
-        # Здесь можно добавить логику для получения всех рейсов из расписания
-        # Для этого нужно расширить API расписания
+        for change in changes:
+            number = change['flight_number']
+            item = self.flight_items.get(number)
+            if change['type'] == CHANGE_REMOVED:
+                if item is not None:
+                    self.flights_tree.delete(item)
+                    del self.flight_items[number]
+                continue
+            values = (number, change['departure_airport'], change['destination_airport'],
+                      change['departure_time'].strftime("%Y-%m-%d %H:%M"),
+                      change['arrival_time'].strftime("%Y-%m-%d %H:%M"),
+                      change['aircraft_id'])
+            if item is None:
+                self.flight_items[number] = self.flights_tree.insert("", tk.END, values=values)
+            else:
+                self.flights_tree.item(item, values=values)
+        if changes:
+            self.flights_version = changes[-1]['version']
     
     def remove_flight(self):
         """Удалить выбранный рейс"""
@@ -13,7 +13,7 @@ import os
 import sys
 import platform
 from datetime import datetime
-from typing import Optional, List, Tuple
+from typing import Iterator, Optional, List, Tuple
 
 # Определяем путь к DLL в зависимости от платформы
 if sys.platform == 'win32':
@@ -121,7 +121,153 @@ c_int = ctypes.c_int
 c_double = ctypes.c_double
 c_longlong = ctypes.c_longlong
 
-BUFFER_SIZE = 8192
+BUFFER_SIZE = 256  # Начальный буфер строки; более длинные строки запрашиваются повторно по длине
+SCHEDULE_EVENT_TEXT_SIZE = 64
+
+# Типы событий расписания (поле type записи ScheduleEventRecord)
+EVENT_FLIGHT_DEPARTED = 0
+EVENT_FLIGHT_ARRIVED = 1
+EVENT_CARGO_OVERDUE = 2
+
+# Виды конфликтов (Schedule.get_conflicts_with_types)
+CONFLICT_OVERLAP = 0
+CONFLICT_TURNAROUND = 1
+CONFLICT_CHAIN = 2
+
+# Коды Schedule.try_add_flight
+ADD_OK = 0
+ADD_INVALID_FLIGHT = 1
+ADD_DUPLICATE_NUMBER = 2
+ADD_OVERLAP = 3
+ADD_TURNAROUND = 4
+ADD_CHAIN = 5
+ADD_NOT_FOUND = 6
+
+# Виды изменений журнала расписания (ScheduleChangeRecord.type)
+CHANGE_ADDED = 0
+CHANGE_REMOVED = 1
+CHANGE_RESCHEDULED = 2
+CHANGE_REASSIGNED = 3
+CHANGE_COMPLETED = 4
+
+# Отрицательные результаты Schedule_GetChangesSince
+CHANGES_RESYNC_REQUIRED = -1
+CHANGES_INVALID_ARGUMENT = -2
+
+# Статусы записей пакетной загрузки (BATCH_ROW_* из FlightScheduleAPI.h)
+BATCH_ROW_OK = 0
+BATCH_ROW_INVALID = 1
+BATCH_ROW_DUPLICATE = 2
+BATCH_ROW_NO_CAPACITY = 3
+
+# Статусы рейсов в выгрузке столбцов (FLIGHT_STATUS_* из FlightScheduleAPI.h)
+FLIGHT_STATUS_SCHEDULED = 0
+FLIGHT_STATUS_IN_PROGRESS = 1
+FLIGHT_STATUS_ARRIVED = 2
+FLIGHT_STATUS_COMPLETED = 3
+
+
+class ScheduleEventRecord(ctypes.Structure):
+    """Запись события расписания (соответствует ScheduleEventRecord из FlightScheduleAPI.h)"""
+    _fields_ = [
+        ("type", c_int),
+        ("time", c_longlong),
+        ("subject", ctypes.c_char * SCHEDULE_EVENT_TEXT_SIZE),
+        ("location", ctypes.c_char * SCHEDULE_EVENT_TEXT_SIZE),
+    ]
+
+class FlightDelayRecord(ctypes.Structure):
+    """Сдвиг рейса при распространении задержки (соответствует FlightDelayRecord из FlightScheduleAPI.h)"""
+    _fields_ = [
+        ("flight_number", ctypes.c_char * SCHEDULE_EVENT_TEXT_SIZE),
+        ("old_departure", c_longlong),
+        ("new_departure", c_longlong),
+        ("old_arrival", c_longlong),
+        ("new_arrival", c_longlong),
+    ]
+
+class ScheduleChangeRecord(ctypes.Structure):
+    """Запись журнала изменений (соответствует ScheduleChangeRecord из FlightScheduleAPI.h)"""
+    _fields_ = [
+        ("version", c_longlong),
+        ("type", c_int),
+        ("flight_number", ctypes.c_char * SCHEDULE_EVENT_TEXT_SIZE),
+        ("departure_airport", ctypes.c_char * SCHEDULE_EVENT_TEXT_SIZE),
+        ("destination_airport", ctypes.c_char * SCHEDULE_EVENT_TEXT_SIZE),
+        ("aircraft_id", ctypes.c_char * SCHEDULE_EVENT_TEXT_SIZE),
+        ("departure_time", c_longlong),
+        ("arrival_time", c_longlong),
+        ("completed", c_int),
+    ]
+
+class FlightRecord(ctypes.Structure):
+    """Рейс в пакете курсора (соответствует FlightRecord из FlightScheduleAPI.h)"""
+    _fields_ = [
+        ("flight_number", ctypes.c_char * SCHEDULE_EVENT_TEXT_SIZE),
+        ("departure_airport", ctypes.c_char * SCHEDULE_EVENT_TEXT_SIZE),
+        ("destination_airport", ctypes.c_char * SCHEDULE_EVENT_TEXT_SIZE),
+        ("aircraft_id", ctypes.c_char * SCHEDULE_EVENT_TEXT_SIZE),
+        ("departure_time", c_longlong),
+        ("arrival_time", c_longlong),
+        ("completed", c_int),
+    ]
+
+class FlightRow(ctypes.Structure):
+    """Рейс пакета: смещения строк в таблице и время (соответствует FlightRow из FlightScheduleAPI.h)"""
+    _fields_ = [
+        ("flight_number", c_int),
+        ("departure_airport", c_int),
+        ("destination_airport", c_int),
+        ("aircraft_id", c_int),
+        ("departure_time", c_longlong),
+        ("arrival_time", c_longlong),
+    ]
+
+class CargoRow(ctypes.Structure):
+    """Груз пакета; deadline != 0 — срочный груз (соответствует CargoRow из FlightScheduleAPI.h)"""
+    _fields_ = [
+        ("cargo_number", c_int),
+        ("departure_airport", c_int),
+        ("destination_airport", c_int),
+        ("current_location", c_int),
+        ("mass", c_double),
+        ("arrival_time", c_longlong),
+        ("deadline", c_longlong),
+    ]
+
+class PassengerRow(ctypes.Structure):
+    """Пассажир пакета (соответствует PassengerRow из FlightScheduleAPI.h)"""
+    _fields_ = [
+        ("passenger_number", c_int),
+        ("name", c_int),
+        ("departure_airport", c_int),
+        ("destination_airport", c_int),
+    ]
+
+class FlightColumns(ctypes.Structure):
+    """Столбцы рейсов для выгрузки в массивы (соответствует FlightColumns из FlightScheduleAPI.h)"""
+    _fields_ = [
+        ("capacity", c_int),
+        ("departure_times", ctypes.POINTER(c_longlong)),
+        ("arrival_times", ctypes.POINTER(c_longlong)),
+        ("aircraft_codes", ctypes.POINTER(c_int)),
+        ("departure_codes", ctypes.POINTER(c_int)),
+        ("destination_codes", ctypes.POINTER(c_int)),
+        ("statuses", ctypes.POINTER(ctypes.c_ubyte)),
+        ("flight_numbers", ctypes.POINTER(ctypes.c_char)),
+        ("flight_number_width", c_int),
+        ("dictionary", ctypes.c_void_p),
+        ("dictionary_count", c_int),
+        ("dictionary_bytes", c_int),
+        ("max_flight_number_length", c_int),
+    ]
+
+# ============================================
+# Strings API
+# ============================================
+
+_lib.FlightSchedule_FreeString.restype = None
+_lib.FlightSchedule_FreeString.argtypes = [ctypes.c_void_p]
 
 # ============================================
 # Schedule API
@@ -136,6 +282,27 @@ _lib.Schedule_Destroy.argtypes = [Handle]
 _lib.Schedule_AddFlight.restype = c_int
 _lib.Schedule_AddFlight.argtypes = [Handle, Handle]
 
+_lib.Schedule_AddFlights.restype = c_int
+_lib.Schedule_AddFlights.argtypes = [Handle, ctypes.POINTER(Handle), c_int, ctypes.POINTER(c_int)]
+
+_lib.Schedule_AddFlightsBatch.restype = c_int
+_lib.Schedule_AddFlightsBatch.argtypes = [Handle, ctypes.POINTER(FlightRow), c_int,
+                                          ctypes.POINTER(ctypes.c_char), c_int, ctypes.POINTER(c_int)]
+
+_lib.Schedule_TryAddFlight.restype = c_int
+_lib.Schedule_TryAddFlight.argtypes = [Handle, Handle, ctypes.POINTER(ctypes.c_char), c_int]
+
+_lib.Schedule_RescheduleFlight.restype = c_int
+_lib.Schedule_RescheduleFlight.argtypes = [Handle, c_char_p, c_longlong, c_longlong, ctypes.POINTER(ctypes.c_char), c_int]
+
+_lib.Schedule_ReassignAircraft.restype = c_int
+_lib.Schedule_ReassignAircraft.argtypes = [Handle, c_char_p, c_char_p, ctypes.POINTER(ctypes.c_char), c_int]
+
+_lib.Schedule_PropagateDelay.restype = c_int
+_lib.Schedule_PropagateDelay.argtypes = [Handle, c_char_p, c_longlong, c_longlong, c_int, c_int,
+                                         ctypes.POINTER(FlightDelayRecord), c_int, ctypes.POINTER(c_int),
+                                         ctypes.POINTER(ctypes.c_char), c_int]
+
 _lib.Schedule_RemoveFlight.restype = c_int
 _lib.Schedule_RemoveFlight.argtypes = [Handle, c_char_p]
 
@@ -145,31 +312,106 @@ _lib.Schedule_FindFlight.argtypes = [Handle, c_char_p]
 _lib.Schedule_IsValid.restype = c_int
 _lib.Schedule_IsValid.argtypes = [Handle]
 
-_lib.Schedule_GetValidationErrors.restype = None
+_lib.Schedule_GetValidationErrors.restype = c_int
 _lib.Schedule_GetValidationErrors.argtypes = [Handle, ctypes.POINTER(ctypes.c_char), c_int]
 
 _lib.Schedule_ValidateAndFix.restype = None
 _lib.Schedule_ValidateAndFix.argtypes = [Handle]
 
-_lib.Schedule_ToString.restype = None
+_lib.Schedule_ToString.restype = c_int
 _lib.Schedule_ToString.argtypes = [Handle, ctypes.POINTER(ctypes.c_char), c_int]
 
-_lib.Schedule_GetScheduleForAircraft.restype = None
+_lib.Schedule_GetScheduleForAircraft.restype = c_int
 _lib.Schedule_GetScheduleForAircraft.argtypes = [Handle, c_char_p, ctypes.POINTER(ctypes.c_char), c_int]
 
-_lib.Schedule_GetScheduleForAircraftInRange.restype = None
+_lib.Schedule_GetScheduleForAircraftInRange.restype = c_int
 _lib.Schedule_GetScheduleForAircraftInRange.argtypes = [Handle, c_char_p, c_longlong, c_longlong, 
                                                         ctypes.POINTER(ctypes.c_char), c_int]
 
-_lib.Schedule_GetOverdueUrgentCargoReport.restype = None
+_lib.Schedule_GetOverdueUrgentCargoReport.restype = c_int
 _lib.Schedule_GetOverdueUrgentCargoReport.argtypes = [Handle, ctypes.POINTER(ctypes.c_char), c_int]
 
+_lib.Schedule_GetValidationErrorsAlloc.restype = ctypes.c_void_p
+_lib.Schedule_GetValidationErrorsAlloc.argtypes = [Handle]
+
+_lib.Schedule_ToStringAlloc.restype = ctypes.c_void_p
+_lib.Schedule_ToStringAlloc.argtypes = [Handle]
+
+_lib.Schedule_GetScheduleForAircraftAlloc.restype = ctypes.c_void_p
+_lib.Schedule_GetScheduleForAircraftAlloc.argtypes = [Handle, c_char_p]
+
+_lib.Schedule_GetScheduleForAircraftInRangeAlloc.restype = ctypes.c_void_p
+_lib.Schedule_GetScheduleForAircraftInRangeAlloc.argtypes = [Handle, c_char_p, c_longlong, c_longlong]
+
+_lib.Schedule_GetOverdueUrgentCargoReportAlloc.restype = ctypes.c_void_p
+_lib.Schedule_GetOverdueUrgentCargoReportAlloc.argtypes = [Handle]
+
 _lib.Schedule_GetTotalFlightTime.restype = c_double
 _lib.Schedule_GetTotalFlightTime.argtypes = [Handle, c_char_p]
 
 _lib.Schedule_GetTotalFlights.restype = c_int
 _lib.Schedule_GetTotalFlights.argtypes = [Handle]
 
+_lib.Schedule_GetFlightNumberAt.restype = c_int
+_lib.Schedule_GetFlightNumberAt.argtypes = [Handle, c_int, ctypes.POINTER(ctypes.c_char), c_int]
+
+_lib.Schedule_ExportColumns.restype = c_int
+_lib.Schedule_ExportColumns.argtypes = [Handle, ctypes.POINTER(FlightColumns)]
+
+_lib.Schedule_GetConflicts.restype = c_int
+_lib.Schedule_GetConflicts.argtypes = [Handle, ctypes.POINTER(c_int), c_int]
+
+_lib.Schedule_GetConflictsWithTypes.restype = c_int
+_lib.Schedule_GetConflictsWithTypes.argtypes = [Handle, ctypes.POINTER(c_int), ctypes.POINTER(c_int), c_int]
+
+_lib.Schedule_SetMinGroundTime.restype = None
+_lib.Schedule_SetMinGroundTime.argtypes = [Handle, c_longlong]
+
+_lib.Schedule_SetAircraftMinGroundTime.restype = None
+_lib.Schedule_SetAircraftMinGroundTime.argtypes = [Handle, c_char_p, c_longlong]
+
+_lib.Schedule_SetAirportMinGroundTime.restype = None
+_lib.Schedule_SetAirportMinGroundTime.argtypes = [Handle, c_char_p, c_longlong]
+
+_lib.Schedule_SetChainCheckEnabled.restype = None
+_lib.Schedule_SetChainCheckEnabled.argtypes = [Handle, c_int]
+
+_lib.Schedule_SetClockTime.restype = None
+_lib.Schedule_SetClockTime.argtypes = [Handle, c_longlong]
+
+_lib.Schedule_UseSystemClock.restype = None
+_lib.Schedule_UseSystemClock.argtypes = [Handle]
+
+_lib.Schedule_RegisterAircraft.restype = None
+_lib.Schedule_RegisterAircraft.argtypes = [Handle, Handle]
+
+_lib.Schedule_RegisterAirport.restype = None
+_lib.Schedule_RegisterAirport.argtypes = [Handle, Handle]
+
+_lib.Schedule_AdvanceClock.restype = c_int
+_lib.Schedule_AdvanceClock.argtypes = [Handle, c_longlong]
+
+_lib.Schedule_PollEvents.restype = c_int
+_lib.Schedule_PollEvents.argtypes = [Handle, ctypes.POINTER(ScheduleEventRecord), c_int]
+
+_lib.Schedule_GetVersion.restype = c_longlong
+_lib.Schedule_GetVersion.argtypes = [Handle]
+
+_lib.Schedule_GetChangesSince.restype = c_int
+_lib.Schedule_GetChangesSince.argtypes = [Handle, c_longlong, ctypes.POINTER(ScheduleChangeRecord), c_int]
+
+_lib.Schedule_OpenCursor.restype = Handle
+_lib.Schedule_OpenCursor.argtypes = [Handle, c_char_p, c_char_p, c_longlong, c_longlong]
+
+_lib.Cursor_Next.restype = c_int
+_lib.Cursor_Next.argtypes = [Handle, ctypes.POINTER(FlightRecord), c_int]
+
+_lib.Cursor_GetVersion.restype = c_longlong
+_lib.Cursor_GetVersion.argtypes = [Handle]
+
+_lib.Cursor_Close.restype = None
+_lib.Cursor_Close.argtypes = [Handle]
+
 # ============================================
 # Flight API
 # ============================================
@@ -180,13 +422,13 @@ _lib.Flight_Create.argtypes = [c_char_p, c_char_p, c_char_p, c_longlong, c_longl
 _lib.Flight_Destroy.restype = None
 _lib.Flight_Destroy.argtypes = [Handle]
 
-_lib.Flight_GetFlightNumber.restype = None
+_lib.Flight_GetFlightNumber.restype = c_int
 _lib.Flight_GetFlightNumber.argtypes = [Handle, ctypes.POINTER(ctypes.c_char), c_int]
 
-_lib.Flight_GetDepartureAirport.restype = None
+_lib.Flight_GetDepartureAirport.restype = c_int
 _lib.Flight_GetDepartureAirport.argtypes = [Handle, ctypes.POINTER(ctypes.c_char), c_int]
 
-_lib.Flight_GetDestinationAirport.restype = None
+_lib.Flight_GetDestinationAirport.restype = c_int
 _lib.Flight_GetDestinationAirport.argtypes = [Handle, ctypes.POINTER(ctypes.c_char), c_int]
 
 _lib.Flight_GetDepartureTime.restype = c_longlong
@@ -195,13 +437,13 @@ _lib.Flight_GetDepartureTime.argtypes = [Handle]
 _lib.Flight_GetArrivalTime.restype = c_longlong
 _lib.Flight_GetArrivalTime.argtypes = [Handle]
 
-_lib.Flight_GetAircraftId.restype = None
+_lib.Flight_GetAircraftId.restype = c_int
 _lib.Flight_GetAircraftId.argtypes = [Handle, ctypes.POINTER(ctypes.c_char), c_int]
 
 _lib.Flight_IsCompleted.restype = c_int
 _lib.Flight_IsCompleted.argtypes = [Handle]
 
-_lib.Flight_ToString.restype = None
+_lib.Flight_ToString.restype = c_int
 _lib.Flight_ToString.argtypes = [Handle, ctypes.POINTER(ctypes.c_char), c_int]
 
 _lib.Flight_IsValid.restype = c_int
@@ -220,7 +462,7 @@ _lib.Aircraft_Create.argtypes = [c_char_p, c_double]
 _lib.Aircraft_Destroy.restype = None
 _lib.Aircraft_Destroy.argtypes = [Handle]
 
-_lib.Aircraft_GetAircraftNumber.restype = None
+_lib.Aircraft_GetAircraftNumber.restype = c_int
 _lib.Aircraft_GetAircraftNumber.argtypes = [Handle, ctypes.POINTER(ctypes.c_char), c_int]
 
 _lib.Aircraft_GetMaxPayload.restype = c_double
@@ -232,9 +474,16 @@ _lib.Aircraft_GetCurrentPayload.argtypes = [Handle]
 _lib.Aircraft_GetAvailableCapacity.restype = c_double
 _lib.Aircraft_GetAvailableCapacity.argtypes = [Handle]
 
-_lib.Aircraft_ToString.restype = None
+_lib.Aircraft_AddCargoBatch.restype = c_int
+_lib.Aircraft_AddCargoBatch.argtypes = [Handle, ctypes.POINTER(CargoRow), c_int,
+                                        ctypes.POINTER(ctypes.c_char), c_int, ctypes.POINTER(c_int)]
+
+_lib.Aircraft_ToString.restype = c_int
 _lib.Aircraft_ToString.argtypes = [Handle, ctypes.POINTER(ctypes.c_char), c_int]
 
+_lib.Aircraft_ToStringAlloc.restype = ctypes.c_void_p
+_lib.Aircraft_ToStringAlloc.argtypes = [Handle]
+
 # ============================================
 # Airport API
 # ============================================
@@ -245,12 +494,19 @@ _lib.Airport_Create.argtypes = [c_char_p]
 _lib.Airport_Destroy.restype = None
 _lib.Airport_Destroy.argtypes = [Handle]
 
-_lib.Airport_GetName.restype = None
+_lib.Airport_GetName.restype = c_int
 _lib.Airport_GetName.argtypes = [Handle, ctypes.POINTER(ctypes.c_char), c_int]
 
-_lib.Airport_ToString.restype = None
+_lib.Airport_AddPassengersBatch.restype = c_int
+_lib.Airport_AddPassengersBatch.argtypes = [Handle, ctypes.POINTER(PassengerRow), c_int,
+                                            ctypes.POINTER(ctypes.c_char), c_int, ctypes.POINTER(c_int)]
+
+_lib.Airport_ToString.restype = c_int
 _lib.Airport_ToString.argtypes = [Handle, ctypes.POINTER(ctypes.c_char), c_int]
 
+_lib.Airport_ToStringAlloc.restype = ctypes.c_void_p
+_lib.Airport_ToStringAlloc.argtypes = [Handle]
+
 # ============================================
 # Cargo API
 # ============================================
@@ -261,13 +517,13 @@ _lib.Cargo_Create.argtypes = [c_char_p, c_double, c_char_p, c_char_p, c_char_p,
 _lib.Cargo_Destroy.restype = None
 _lib.Cargo_Destroy.argtypes = [Handle]
 
-_lib.Cargo_GetCargoNumber.restype = None
+_lib.Cargo_GetCargoNumber.restype = c_int
 _lib.Cargo_GetCargoNumber.argtypes = [Handle, ctypes.POINTER(ctypes.c_char), c_int]
 
 _lib.Cargo_GetMass.restype = c_double
 _lib.Cargo_GetMass.argtypes = [Handle]
 
-_lib.Cargo_ToString.restype = None
+_lib.Cargo_ToString.restype = c_int
 _lib.Cargo_ToString.argtypes = [Handle, ctypes.POINTER(ctypes.c_char), c_int]
 
 # ============================================
@@ -283,7 +539,7 @@ _lib.UrgentCargo_Destroy.argtypes = [Handle]
 _lib.UrgentCargo_IsOverdue.restype = c_int
 _lib.UrgentCargo_IsOverdue.argtypes = [Handle]
 
-_lib.UrgentCargo_ToString.restype = None
+_lib.UrgentCargo_ToString.restype = c_int
 _lib.UrgentCargo_ToString.argtypes = [Handle, ctypes.POINTER(ctypes.c_char), c_int]
 
 # ============================================
@@ -296,29 +552,54 @@ _lib.Passenger_Create.argtypes = [c_char_p, c_char_p, c_char_p, c_char_p]
 _lib.Passenger_Destroy.restype = None
 _lib.Passenger_Destroy.argtypes = [Handle]
 
-_lib.Passenger_GetPassengerNumber.restype = None
+_lib.Passenger_GetPassengerNumber.restype = c_int
 _lib.Passenger_GetPassengerNumber.argtypes = [Handle, ctypes.POINTER(ctypes.c_char), c_int]
 
-_lib.Passenger_GetName.restype = None
+_lib.Passenger_GetName.restype = c_int
 _lib.Passenger_GetName.argtypes = [Handle, ctypes.POINTER(ctypes.c_char), c_int]
 
-_lib.Passenger_ToString.restype = None
+_lib.Passenger_ToString.restype = c_int
 _lib.Passenger_ToString.argtypes = [Handle, ctypes.POINTER(ctypes.c_char), c_int]
 
 
 def _get_string(func, handle, *args):
     """Вспомогательная функция для получения строк из DLL.
 
-    :param func: C-функция вида func(handle, ..., buffer, bufferSize)
+    Функция возвращает полную длину строки; если строка не поместилась
+    в начальный буфер, она запрашивается повторно в буфер нужного размера.
+
+    :param func: C-функция вида func(handle, ..., buffer, bufferSize) -> длина строки
     :param handle: указатель на объект C++
     :param args: дополнительные аргументы перед buffer и bufferSize
     :return: декодированная строка UTF-8
     :rtype: str
     """
     buffer = ctypes.create_string_buffer(BUFFER_SIZE)
-    func(handle, *args, buffer, BUFFER_SIZE)
-    result = buffer.value.decode('utf-8', errors='ignore')
-    return result.rstrip('\x00')
+    length = func(handle, *args, buffer, BUFFER_SIZE)
+    if length >= BUFFER_SIZE:
+        buffer = ctypes.create_string_buffer(length + 1)
+        func(handle, *args, buffer, length + 1)
+    return buffer.value.decode('utf-8', errors='ignore')
+
+
+def _get_alloc_string(func, handle, *args):
+    """Получить строку, выделенную DLL (...Alloc-функции), и освободить её.
+
+    Отчёт форматируется один раз и возвращается целиком.
+
+    :param func: C-функция вида func(handle, ...) -> char*
+    :param handle: указатель на объект C++
+    :param args: дополнительные аргументы
+    :return: декодированная строка UTF-8 (пустая при ошибке)
+    :rtype: str
+    """
+    pointer = func(handle, *args)
+    if not pointer:
+        return ""
+    try:
+        return ctypes.string_at(pointer).decode('utf-8', errors='ignore')
+    finally:
+        _lib.FlightSchedule_FreeString(pointer)
 
 
 def _to_bytes(s: str) -> bytes:
@@ -331,6 +612,58 @@ def _to_bytes(s: str) -> bytes:
     return s.encode('utf-8') if isinstance(s, str) else s
 
 
+class _StringTable:
+    """Таблица строк пакета: строки, завершённые нулём, с повторным использованием одинаковых."""
+
+    def __init__(self):
+        self._data = bytearray()
+        self._offsets = {}
+
+    def add(self, s: str) -> int:
+        """Смещение строки в таблице (одинаковые строки хранятся один раз).
+
+        :param s: строка
+        :return: смещение от начала таблицы
+        :rtype: int
+        """
+        offset = self._offsets.get(s)
+        if offset is None:
+            offset = len(self._data)
+            self._data += _to_bytes(s) + b'\x00'
+            self._offsets[s] = offset
+        return offset
+
+    def buffer(self):
+        """Буфер таблицы и его размер для передачи в C API.
+
+        :return: (буфер, размер)
+        :rtype: tuple
+        """
+        size = len(self._data)
+        return ctypes.create_string_buffer(bytes(self._data), max(size, 1)), size
+
+
+def _run_batch(func, handle, row_type, rows: list, table: _StringTable) -> List[int]:
+    """Вызвать пакетную функцию C API и вернуть статусы записей.
+
+    :param func: C-функция вида func(handle, rows, rowCount, strings, stringsSize, statuses)
+    :param handle: указатель на объект C++
+    :param row_type: тип записи (FlightRow, CargoRow, PassengerRow)
+    :param rows: заполненные записи
+    :param table: таблица строк записей
+    :return: статусы BATCH_ROW_* по записям
+    :rtype: List[int]
+    """
+    if not rows:
+        return []
+    count = len(rows)
+    array = (row_type * count)(*rows)
+    statuses = (c_int * count)()
+    strings, size = table.buffer()
+    func(handle, array, count, strings, size, statuses)
+    return list(statuses)
+
+
 def datetime_to_timestamp(dt: datetime) -> int:
     """Преобразует datetime в Unix timestamp.
 
@@ -360,7 +693,9 @@ def timestamp_to_datetime(ts: int) -> datetime:
 class Schedule:
     """Обёртка над C++ Schedule: контейнер рейсов, валидация, отчёты.
 
-    Создаёт объект расписания в DLL. Рейсы добавляются через add_flight().
+    Создаёт объект расписания в DLL. Рейсы добавляются через add_flight(),
+    а при загрузке многих рейсов — через add_flights() или add_flights_batch():
+    вставка по одному стоит O(n) на рейс.
     """
 
     def __init__(self):
@@ -375,12 +710,122 @@ class Schedule:
     def add_flight(self, flight: 'Flight') -> bool:
         """Добавить рейс в расписание.
 
+        Рейс разделяется с расписанием: изменения видны через flight. Рейс,
+        уже принадлежащий расписанию, добавляется копией.
+
         :param flight: объект рейса (Flight)
         :return: True при успехе
         :rtype: bool
         """
         return _lib.Schedule_AddFlight(self._handle, flight._handle) != 0
 
+    def add_flights(self, flights: List['Flight']) -> List[int]:
+        """Добавить готовые рейсы одним слиянием.
+
+        Рейсы разделяются с расписанием, как в add_flight(). Для загрузки многих
+        рейсов этот вызов заменяет цикл add_flight(), стоимость которого квадратична.
+
+        :param flights: объекты рейсов (Flight)
+        :return: статусы по рейсам: BATCH_ROW_OK, BATCH_ROW_INVALID или BATCH_ROW_DUPLICATE
+        :rtype: List[int]
+        """
+        if not flights:
+            return []
+        count = len(flights)
+        handles = (Handle * count)(*[flight._handle for flight in flights])
+        statuses = (c_int * count)()
+        _lib.Schedule_AddFlights(self._handle, handles, count, statuses)
+        return list(statuses)
+
+    def add_flights_batch(self, flights: List[Tuple[str, str, str, datetime, datetime, str]]) -> List[int]:
+        """Создать и добавить пакет рейсов одним вызовом DLL.
+
+        :param flights: кортежи (номер, вылет, назначение, время вылета, время прибытия, борт)
+        :return: статусы по рейсам: BATCH_ROW_OK, BATCH_ROW_INVALID или BATCH_ROW_DUPLICATE
+        :rtype: List[int]
+        """
+        table = _StringTable()
+        rows = [FlightRow(table.add(number), table.add(departure), table.add(destination), table.add(aircraft_id),
+                          datetime_to_timestamp(dep_time), datetime_to_timestamp(arr_time))
+                for number, departure, destination, dep_time, arr_time, aircraft_id in flights]
+        return _run_batch(_lib.Schedule_AddFlightsBatch, self._handle, FlightRow, rows, table)
+
+    def try_add_flight(self, flight: 'Flight') -> Tuple[int, str]:
+        """Добавить рейс, только если он не конфликтует с рейсами того же самолёта.
+
+        :param flight: рейс (разделяется с расписанием, как в add_flight)
+        :return: (код ADD_*, номер рейса, с которым найден конфликт)
+        :rtype: Tuple[int, str]
+        """
+        buffer = ctypes.create_string_buffer(256)
+        code = _lib.Schedule_TryAddFlight(self._handle, flight._handle, buffer, len(buffer))
+        return code, buffer.value.decode('utf-8', errors='replace')
+
+    def reschedule_flight(self, flight_number: str, departure: datetime, arrival: datetime) -> Tuple[int, str]:
+        """Перенести рейс на новое время с сохранением порядка расписания.
+
+        :param flight_number: номер рейса
+        :param departure: новое время вылета
+        :param arrival: новое время прибытия
+        :return: (код ADD_*, номер рейса, с которым найден конфликт); при ненулевом коде рейс не меняется
+        :rtype: Tuple[int, str]
+        """
+        buffer = ctypes.create_string_buffer(256)
+        code = _lib.Schedule_RescheduleFlight(self._handle, _to_bytes(flight_number),
+                                              datetime_to_timestamp(departure), datetime_to_timestamp(arrival),
+                                              buffer, len(buffer))
+        return code, buffer.value.decode('utf-8', errors='replace')
+
+    def reassign_aircraft(self, flight_number: str, aircraft_id: str) -> Tuple[int, str]:
+        """Передать рейс другому самолёту.
+
+        :param flight_number: номер рейса
+        :param aircraft_id: бортовой номер нового самолёта
+        :return: (код ADD_*, номер рейса, с которым найден конфликт); при ненулевом коде рейс не меняется
+        :rtype: Tuple[int, str]
+        """
+        buffer = ctypes.create_string_buffer(256)
+        code = _lib.Schedule_ReassignAircraft(self._handle, _to_bytes(flight_number), _to_bytes(aircraft_id),
+                                              buffer, len(buffer))
+        return code, buffer.value.decode('utf-8', errors='replace')
+
+    def propagate_delay(self, flight_number: str, delay_seconds: int, horizon_seconds: int = 24 * 60 * 60,
+                        respect_ground_time: bool = True, apply: bool = True) -> Tuple[int, List[dict], str]:
+        """Задержать рейс и сдвинуть дальнейшие рейсы того же самолёта.
+
+        :param flight_number: номер задержанного рейса
+        :param delay_seconds: задержка в секундах
+        :param horizon_seconds: горизонт сдвига от исходного вылета (0 — без ограничения)
+        :param respect_ground_time: учитывать минимальную стоянку
+        :param apply: применить сдвиги (False — только рассчитать)
+        :return: (код ADD_*, список сдвигов, номер рейса за горизонтом, с которым остался конфликт)
+        :rtype: Tuple[int, List[dict], str]
+        """
+        # Сначала только расчёт: он сообщает полное число сдвигов для размера массива
+        count = c_int(0)
+        capacity = 64
+        while True:
+            records = (FlightDelayRecord * capacity)()
+            buffer = ctypes.create_string_buffer(256)
+            code = _lib.Schedule_PropagateDelay(self._handle, _to_bytes(flight_number), delay_seconds,
+                                                horizon_seconds, int(respect_ground_time), 0,
+                                                records, capacity, ctypes.byref(count), buffer, len(buffer))
+            if count.value <= capacity:
+                break
+            capacity = count.value
+        if apply and code not in (ADD_INVALID_FLIGHT, ADD_NOT_FOUND):
+            code = _lib.Schedule_PropagateDelay(self._handle, _to_bytes(flight_number), delay_seconds,
+                                                horizon_seconds, int(respect_ground_time), 1,
+                                                records, capacity, ctypes.byref(count), buffer, len(buffer))
+        changes = [{
+            'flight_number': records[i].flight_number.decode('utf-8', errors='replace'),
+            'old_departure': timestamp_to_datetime(records[i].old_departure),
+            'new_departure': timestamp_to_datetime(records[i].new_departure),
+            'old_arrival': timestamp_to_datetime(records[i].old_arrival),
+            'new_arrival': timestamp_to_datetime(records[i].new_arrival),
+        } for i in range(min(count.value, capacity))]
+        return code, changes, buffer.value.decode('utf-8', errors='replace')
+
     def remove_flight(self, flight_number: str) -> bool:
         """Удалить рейс из расписания по номеру.
 
@@ -393,6 +838,9 @@ class Schedule:
     def find_flight(self, flight_number: str) -> Optional['Flight']:
         """Найти рейс по номеру.
 
+        Возвращается сам рейс расписания, а не копия: переносы и завершение
+        через расписание видны в полученном объекте.
+
         :param flight_number: номер рейса
         :return: Flight или None
         :rtype: Optional[Flight]
@@ -408,7 +856,7 @@ class Schedule:
     
     def get_validation_errors(self) -> List[str]:
         """Получить список ошибок валидации"""
-        errors_str = _get_string(_lib.Schedule_GetValidationErrors, self._handle)
+        errors_str = _get_alloc_string(_lib.Schedule_GetValidationErrorsAlloc, self._handle)
         return [e for e in errors_str.split('\n') if e.strip()]
     
     def validate_and_fix(self):
@@ -417,23 +865,23 @@ class Schedule:
     
     def to_string(self) -> str:
         """Получить строковое представление расписания"""
-        return _get_string(_lib.Schedule_ToString, self._handle)
+        return _get_alloc_string(_lib.Schedule_ToStringAlloc, self._handle)
     
     def get_schedule_for_aircraft(self, aircraft_id: str) -> str:
         """Получить расписание для самолёта"""
-        return _get_string(_lib.Schedule_GetScheduleForAircraft, self._handle, _to_bytes(aircraft_id))
+        return _get_alloc_string(_lib.Schedule_GetScheduleForAircraftAlloc, self._handle, _to_bytes(aircraft_id))
     
     def get_schedule_for_aircraft_in_range(self, aircraft_id: str, 
                                            start_time: datetime, end_time: datetime) -> str:
         """Получить расписание самолёта в диапазоне времени"""
         start_ts = datetime_to_timestamp(start_time)
         end_ts = datetime_to_timestamp(end_time)
-        return _get_string(_lib.Schedule_GetScheduleForAircraftInRange, 
-                          self._handle, _to_bytes(aircraft_id), start_ts, end_ts)
+        return _get_alloc_string(_lib.Schedule_GetScheduleForAircraftInRangeAlloc,
+                                 self._handle, _to_bytes(aircraft_id), start_ts, end_ts)
     
     def get_overdue_urgent_cargo_report(self) -> str:
         """Получить отчёт о просроченных срочных грузах"""
-        return _get_string(_lib.Schedule_GetOverdueUrgentCargoReport, self._handle)
+        return _get_alloc_string(_lib.Schedule_GetOverdueUrgentCargoReportAlloc, self._handle)
     
     def get_total_flight_time(self, aircraft_id: str) -> float:
         """Получить общее время полётов самолёта"""
@@ -443,6 +891,257 @@ class Schedule:
         """Получить общее количество рейсов"""
         return _lib.Schedule_GetTotalFlights(self._handle)
 
+    def get_conflicts(self) -> List[Tuple[str, str]]:
+        """Получить все пары конфликтующих рейсов.
+
+        :return: список пар номеров рейсов одного самолёта с пересекающимся временем
+        :rtype: List[Tuple[str, str]]
+        """
+        total = _lib.Schedule_GetConflicts(self._handle, None, 0)
+        if total <= 0:
+            return []
+        pairs = (c_int * (2 * total))()
+        total = min(total, _lib.Schedule_GetConflicts(self._handle, pairs, total))
+        numbers = {}
+        result = []
+        for i in range(total):
+            first, second = pairs[2 * i], pairs[2 * i + 1]
+            for index in (first, second):
+                if index not in numbers:
+                    numbers[index] = _get_string(_lib.Schedule_GetFlightNumberAt, self._handle, index)
+            result.append((numbers[first], numbers[second]))
+        return result
+
+    def get_conflicts_with_types(self) -> List[Tuple[str, str, int]]:
+        """Получить все конфликты вместе с их видом.
+
+        :return: список (номер рейса, номер рейса, CONFLICT_*)
+        :rtype: List[Tuple[str, str, int]]
+        """
+        total = _lib.Schedule_GetConflictsWithTypes(self._handle, None, None, 0)
+        if total <= 0:
+            return []
+        pairs = (c_int * (2 * total))()
+        types = (c_int * total)()
+        total = min(total, _lib.Schedule_GetConflictsWithTypes(self._handle, pairs, types, total))
+        numbers = {}
+        result = []
+        for i in range(total):
+            first, second = pairs[2 * i], pairs[2 * i + 1]
+            for index in (first, second):
+                if index not in numbers:
+                    numbers[index] = _get_string(_lib.Schedule_GetFlightNumberAt, self._handle, index)
+            result.append((numbers[first], numbers[second], types[i]))
+        return result
+
+    def set_min_ground_time(self, seconds: int):
+        """Минимальная стоянка между рейсами любого самолёта (секунды)."""
+        _lib.Schedule_SetMinGroundTime(self._handle, seconds)
+
+    def set_aircraft_min_ground_time(self, aircraft_id: str, seconds: int):
+        """Минимальная стоянка самолёта (секунды; 0 снимает правило)."""
+        _lib.Schedule_SetAircraftMinGroundTime(self._handle, _to_bytes(aircraft_id), seconds)
+
+    def set_airport_min_ground_time(self, airport_code: str, seconds: int):
+        """Минимальная стоянка в аэропорту (секунды; 0 снимает правило)."""
+        _lib.Schedule_SetAirportMinGroundTime(self._handle, _to_bytes(airport_code), seconds)
+
+    def set_chain_check_enabled(self, enabled: bool):
+        """Требовать, чтобы рейс самолёта вылетал из аэропорта прибытия предыдущего."""
+        _lib.Schedule_SetChainCheckEnabled(self._handle, 1 if enabled else 0)
+
+    def set_clock_time(self, time: datetime):
+        """Зафиксировать часы расписания на заданном моменте.
+
+        Статусы рейсов и отчёты расписания считаются относительно этого момента.
+
+        :param time: момент времени
+        :type time: datetime.datetime
+        """
+        _lib.Schedule_SetClockTime(self._handle, datetime_to_timestamp(time))
+
+    def use_system_clock(self):
+        """Вернуть расписанию системные часы."""
+        _lib.Schedule_UseSystemClock(self._handle)
+
+    def register_aircraft(self, aircraft: 'Aircraft'):
+        """Подключить срочные грузы самолёта к отчёту о просроченных грузах.
+
+        :param aircraft: самолёт; его грузы, добавленные позже, учитываются автоматически
+        """
+        _lib.Schedule_RegisterAircraft(self._handle, aircraft._handle)
+
+    def register_airport(self, airport: 'Airport'):
+        """Подключить срочные грузы аэропорта к отчёту о просроченных грузах.
+
+        :param airport: аэропорт; его грузы, добавленные позже, учитываются автоматически
+        """
+        _lib.Schedule_RegisterAirport(self._handle, airport._handle)
+
+    def advance_clock(self, time: datetime) -> int:
+        """Поставить в очередь события, наступившие к моменту time.
+
+        Ручные часы (set_clock_time) переводятся на time; системные часы не подменяются.
+
+        :param time: новый момент часов
+        :type time: datetime.datetime
+        :return: число новых событий (вылеты, прибытия, просрочка грузов)
+        :rtype: int
+        """
+        return _lib.Schedule_AdvanceClock(self._handle, datetime_to_timestamp(time))
+
+    def poll_events(self, max_events: int = 256) -> List[Tuple[int, datetime, str, str]]:
+        """Забрать события из очереди в порядке наступления.
+
+        :param max_events: максимальное число событий за вызов
+        :return: список (тип EVENT_*, момент, номер рейса или груза, место)
+        :rtype: List[Tuple[int, datetime, str, str]]
+        """
+        records = (ScheduleEventRecord * max_events)()
+        count = _lib.Schedule_PollEvents(self._handle, records, max_events)
+        return [(r.type, timestamp_to_datetime(r.time),
+                 r.subject.decode('utf-8', errors='replace'),
+                 r.location.decode('utf-8', errors='replace'))
+                for r in records[:count]]
+
+    def get_version(self) -> int:
+        """Текущая версия расписания (растёт с каждым изменением рейсов).
+
+        :return: номер версии
+        :rtype: int
+        """
+        return _lib.Schedule_GetVersion(self._handle)
+
+    def get_changes_since(self, version: int, page_size: int = 1024) -> Optional[List[dict]]:
+        """Изменения рейсов после версии version (по возрастанию версий).
+
+        :param version: версия, до которой изменения уже применены клиентом
+        :param page_size: число записей за один вызов библиотеки
+        :return: список изменений (version, type CHANGE_*, flight_number, departure_airport,
+                 destination_airport, aircraft_id, departure_time, arrival_time, completed)
+                 или None, если журнал уже не содержит всех изменений (нужна полная загрузка)
+        :rtype: Optional[List[dict]]
+        """
+        records = (ScheduleChangeRecord * page_size)()
+        changes = []
+        while True:
+            count = _lib.Schedule_GetChangesSince(self._handle, version, records, page_size)
+            if count == CHANGES_INVALID_ARGUMENT:
+                raise ValueError("Invalid arguments for get_changes_since")
+            if count < 0:
+                return None
+            for r in records[:count]:
+                changes.append({
+                    'version': r.version,
+                    'type': r.type,
+                    'flight_number': r.flight_number.decode('utf-8', errors='replace'),
+                    'departure_airport': r.departure_airport.decode('utf-8', errors='replace'),
+                    'destination_airport': r.destination_airport.decode('utf-8', errors='replace'),
+                    'aircraft_id': r.aircraft_id.decode('utf-8', errors='replace'),
+                    'departure_time': timestamp_to_datetime(r.departure_time),
+                    'arrival_time': timestamp_to_datetime(r.arrival_time),
+                    'completed': r.completed != 0,
+                })
+            if count < page_size:
+                return changes
+            version = records[count - 1].version
+
+    def to_arrays(self, flight_number_width: int = 16) -> Tuple[dict, List[str]]:
+        """Выгрузить рейсы в массивы NumPy одним вызовом библиотеки (без объектов на каждый рейс).
+
+        Массивы заполняются библиотекой напрямую. Бортовые номера и аэропорты
+        выгружаются кодами словаря, например для pandas:
+        ``pd.Categorical.from_codes(columns['aircraft'], dictionary)``.
+
+        :param flight_number_width: начальная ширина поля номера рейса, байт (при более длинных номерах увеличивается)
+        :return: (столбцы, словарь); столбцы — flight_number (S), departure_time и arrival_time
+                 (int64, Unix time), aircraft, departure_airport и destination_airport (int32, коды словаря),
+                 status (uint8, FLIGHT_STATUS_*)
+        :rtype: Tuple[dict, List[str]]
+        """
+        import numpy as np
+
+        width = max(1, flight_number_width)
+        while True:
+            count = _lib.Schedule_GetTotalFlights(self._handle)
+            columns = {
+                'flight_number': np.zeros(count, dtype='S%d' % width),
+                'departure_time': np.empty(count, dtype=np.int64),
+                'arrival_time': np.empty(count, dtype=np.int64),
+                'aircraft': np.empty(count, dtype=np.int32),
+                'departure_airport': np.empty(count, dtype=np.int32),
+                'destination_airport': np.empty(count, dtype=np.int32),
+                'status': np.empty(count, dtype=np.uint8),
+            }
+            spec = FlightColumns()
+            spec.capacity = count
+            spec.departure_times = columns['departure_time'].ctypes.data_as(ctypes.POINTER(c_longlong))
+            spec.arrival_times = columns['arrival_time'].ctypes.data_as(ctypes.POINTER(c_longlong))
+            spec.aircraft_codes = columns['aircraft'].ctypes.data_as(ctypes.POINTER(c_int))
+            spec.departure_codes = columns['departure_airport'].ctypes.data_as(ctypes.POINTER(c_int))
+            spec.destination_codes = columns['destination_airport'].ctypes.data_as(ctypes.POINTER(c_int))
+            spec.statuses = columns['status'].ctypes.data_as(ctypes.POINTER(ctypes.c_ubyte))
+            spec.flight_numbers = columns['flight_number'].ctypes.data_as(ctypes.POINTER(ctypes.c_char))
+            spec.flight_number_width = width
+            rows = _lib.Schedule_ExportColumns(self._handle, ctypes.byref(spec))
+            try:
+                dictionary = []
+                if spec.dictionary:
+                    block = ctypes.string_at(spec.dictionary, spec.dictionary_bytes)
+                    dictionary = [entry.decode('utf-8', errors='replace')
+                                  for entry in block.split(b'\x00')[:spec.dictionary_count]]
+            finally:
+                _lib.FlightSchedule_FreeString(spec.dictionary)
+            if rows < 0:
+                raise RuntimeError("Не удалось выгрузить рейсы в массивы")
+            if spec.max_flight_number_length <= width:
+                return columns, dictionary
+            # Номера не поместились: повторяем с шириной по самому длинному номеру
+            width = spec.max_flight_number_length
+
+    def iter_flights(self, aircraft_id: Optional[str] = None, airport: Optional[str] = None,
+                     start: Optional[datetime] = None, end: Optional[datetime] = None,
+                     batch_size: int = 256) -> Iterator[dict]:
+        """Перебрать рейсы в порядке вылета пакетами через курсор (без текстового вывода).
+
+        Изменения расписания во время перебора допустимы: перебор продолжается с места
+        остановки; сверить версии можно через get_version и get_changes_since.
+
+        :param aircraft_id: только рейсы самолёта
+        :param airport: только рейсы с вылетом из аэропорта или прилётом в него
+        :param start: вылет не раньше
+        :param end: вылет не позже
+        :param batch_size: число рейсов за один вызов библиотеки
+        :return: рейсы (flight_number, departure_airport, destination_airport, aircraft_id,
+                 departure_time, arrival_time, completed)
+        :rtype: Iterator[dict]
+        """
+        cursor = _lib.Schedule_OpenCursor(self._handle,
+                                          _to_bytes(aircraft_id) if aircraft_id else None,
+                                          _to_bytes(airport) if airport else None,
+                                          datetime_to_timestamp(start) if start else 0,
+                                          datetime_to_timestamp(end) if end else 0)
+        if not cursor:
+            return
+        try:
+            records = (FlightRecord * batch_size)()
+            while True:
+                count = _lib.Cursor_Next(cursor, records, batch_size)
+                if count <= 0:
+                    break
+                for r in records[:count]:
+                    yield {
+                        'flight_number': r.flight_number.decode('utf-8', errors='replace'),
+                        'departure_airport': r.departure_airport.decode('utf-8', errors='replace'),
+                        'destination_airport': r.destination_airport.decode('utf-8', errors='replace'),
+                        'aircraft_id': r.aircraft_id.decode('utf-8', errors='replace'),
+                        'departure_time': timestamp_to_datetime(r.departure_time),
+                        'arrival_time': timestamp_to_datetime(r.arrival_time),
+                        'completed': r.completed != 0,
+                    }
+        finally:
+            _lib.Cursor_Close(cursor)
+
 
 class Flight:
     """Python класс для работы с рейсом"""
@@ -563,9 +1262,24 @@ class Aircraft:
         """Доступная грузоподъёмность"""
         return _lib.Aircraft_GetAvailableCapacity(self._handle)
     
+    def add_cargo_batch(self, cargo: List[Tuple[str, float, str, str, str, datetime, Optional[datetime]]]) -> List[int]:
+        """Создать и погрузить пакет грузов одним вызовом DLL.
+
+        :param cargo: кортежи (номер, масса, отправление, назначение, местоположение, прибытие, срок);
+                      срок None — обычный груз, иначе срочный
+        :return: статусы по грузам: BATCH_ROW_OK, BATCH_ROW_INVALID или BATCH_ROW_NO_CAPACITY
+        :rtype: List[int]
+        """
+        table = _StringTable()
+        rows = [CargoRow(table.add(number), table.add(departure), table.add(destination), table.add(current),
+                         c_double(mass), datetime_to_timestamp(arrival),
+                         datetime_to_timestamp(deadline) if deadline else 0)
+                for number, mass, departure, destination, current, arrival, deadline in cargo]
+        return _run_batch(_lib.Aircraft_AddCargoBatch, self._handle, CargoRow, rows, table)
+
     def to_string(self) -> str:
         """Получить строковое представление самолёта"""
-        return _get_string(_lib.Aircraft_ToString, self._handle)
+        return _get_alloc_string(_lib.Aircraft_ToStringAlloc, self._handle)
 
 
 class Airport:
@@ -585,9 +1299,21 @@ class Airport:
         """Название аэропорта"""
         return _get_string(_lib.Airport_GetName, self._handle)
     
+    def add_passengers_batch(self, passengers: List[Tuple[str, str, str, str]]) -> List[int]:
+        """Создать и добавить пакет пассажиров одним вызовом DLL.
+
+        :param passengers: кортежи (номер, имя, отправление, назначение)
+        :return: статусы по пассажирам: BATCH_ROW_OK или BATCH_ROW_INVALID
+        :rtype: List[int]
+        """
+        table = _StringTable()
+        rows = [PassengerRow(table.add(number), table.add(name), table.add(departure), table.add(destination))
+                for number, name, departure, destination in passengers]
+        return _run_batch(_lib.Airport_AddPassengersBatch, self._handle, PassengerRow, rows, table)
+
     def to_string(self) -> str:
         """Получить строковое представление аэропорта"""
-        return _get_string(_lib.Airport_ToString, self._handle)
+        return _get_alloc_string(_lib.Airport_ToStringAlloc, self._handle)
 
 
 class Cargo:
@@ -3,14 +3,15 @@
 #include <sstream>
 #include <algorithm>
 #include <iomanip>
+#include <utility>
 
 // Конструктор по умолчанию
-Aircraft::Aircraft() : aircraftNumber(""), maxPayload(0.0) {
+Aircraft::Aircraft() : aircraftNumber(""), maxPayload(0.0), urgentCargoRegistry("Aircraft ") {
 }
 
 // Конструктор с параметрами
 Aircraft::Aircraft(const std::string& number, double maxPayload) 
-    : aircraftNumber(number), maxPayload(maxPayload) {
+    : aircraftNumber(number), maxPayload(maxPayload), urgentCargoRegistry("Aircraft " + number) {
     // Проверяем корректность грузоподъёмности
     if (maxPayload <= 0.0) {
         throw InvalidAircraftException(
@@ -23,8 +24,7 @@ Aircraft::Aircraft(const std::string& number, double maxPayload)
 // Конструктор копирования
 Aircraft::Aircraft(const Aircraft& other)
     : aircraftNumber(other.aircraftNumber), maxPayload(other.maxPayload),
-      cargoList(other.cargoList), urgentCargoList(other.urgentCargoList),
-      passengerList(other.passengerList) {
+      cargoList(other.cargoList), urgentCargoRegistry(other.urgentCargoRegistry), passengerList(other.passengerList) {
 }
 
 // Оператор присваивания
@@ -33,7 +33,7 @@ Aircraft& Aircraft::operator=(const Aircraft& other) {
         aircraftNumber = other.aircraftNumber;
         maxPayload = other.maxPayload;
         cargoList = other.cargoList;
-        urgentCargoList = other.urgentCargoList;
+        urgentCargoRegistry = other.urgentCargoRegistry;
         passengerList = other.passengerList;
     }
     return *this;
@@ -41,7 +41,7 @@ Aircraft& Aircraft::operator=(const Aircraft& other) {
 
 // Деструктор
 Aircraft::~Aircraft() {
-    // Деструктор пустой, так как мы используем shared_ptr
+    // Деструктор пустой: записи в общем индексе удаляет реестр срочных грузов
 }
 
 // Геттеры
@@ -64,7 +64,7 @@ double Aircraft::getCurrentPayload() const {
     }
     
     // Добавляем вес срочных грузов
-    for (const auto& urgentCargo : urgentCargoList) {
+    for (const auto& urgentCargo : urgentCargoRegistry.getList()) {
         if (urgentCargo) {
             currentWeight += urgentCargo->getMass();
         }
@@ -85,7 +85,7 @@ const std::vector<std::shared_ptr<Cargo>>& Aircraft::getCargoList() const {
 }
 
 const std::vector<std::shared_ptr<UrgentCargo>>& Aircraft::getUrgentCargoList() const {
-    return urgentCargoList;
+    return urgentCargoRegistry.getList();
 }
 
 const std::vector<std::shared_ptr<Passenger>>& Aircraft::getPassengerList() const {
@@ -95,6 +95,7 @@ const std::vector<std::shared_ptr<Passenger>>& Aircraft::getPassengerList() cons
 // Сеттеры
 void Aircraft::setAircraftNumber(const std::string& number) {
     aircraftNumber = number;
+    urgentCargoRegistry.setLocation("Aircraft " + number);
 }
 
 void Aircraft::setMaxPayload(double maxPayload) {
@@ -124,7 +125,12 @@ bool Aircraft::addCargo(std::shared_ptr<Cargo> cargo) {
 }
 
 bool Aircraft::addUrgentCargo(std::shared_ptr<UrgentCargo> urgentCargo) {
-    if (!urgentCargo || !urgentCargo->isValid()) {
+    return addUrgentCargo(std::move(urgentCargo), std::time(nullptr));
+}
+
+// Добавить срочный груз, проверив срок на момент now (пакетная загрузка читает часы один раз)
+bool Aircraft::addUrgentCargo(std::shared_ptr<UrgentCargo> urgentCargo, std::time_t now) {
+    if (!urgentCargo || !urgentCargo->isValid(now)) {
         return false;
     }
     
@@ -133,7 +139,7 @@ bool Aircraft::addUrgentCargo(std::shared_ptr<UrgentCargo> urgentCargo) {
         return false;
     }
     
-    urgentCargoList.push_back(urgentCargo);
+    urgentCargoRegistry.add(std::move(urgentCargo));
     return true;
 }
 
@@ -148,13 +154,7 @@ void Aircraft::removeCargo(const std::string& cargoNumber) {
 }
 
 void Aircraft::removeUrgentCargo(const std::string& cargoNumber) {
-    urgentCargoList.erase(
-        std::remove_if(urgentCargoList.begin(), urgentCargoList.end(),
-            [&cargoNumber](const std::shared_ptr<UrgentCargo>& cargo) {
-                return cargo && cargo->getCargoNumber() == cargoNumber;
-            }),
-        urgentCargoList.end()
-    );
+    urgentCargoRegistry.remove(cargoNumber);
 }
 
 std::shared_ptr<Cargo> Aircraft::findCargo(const std::string& cargoNumber) const {
@@ -167,12 +167,7 @@ std::shared_ptr<Cargo> Aircraft::findCargo(const std::string& cargoNumber) const
 }
 
 std::shared_ptr<UrgentCargo> Aircraft::findUrgentCargo(const std::string& cargoNumber) const {
-    auto it = std::find_if(urgentCargoList.begin(), urgentCargoList.end(),
-        [&cargoNumber](const std::shared_ptr<UrgentCargo>& cargo) {
-            return cargo && cargo->getCargoNumber() == cargoNumber;
-        });
-    
-    return (it != urgentCargoList.end()) ? *it : nullptr;
+    return urgentCargoRegistry.find(cargoNumber);
 }
 
 // Методы для работы с пассажирами
@@ -226,13 +221,13 @@ int Aircraft::getTotalPassengerCount() const {
 
 // Получить общее количество грузов
 int Aircraft::getTotalCargoCount() const {
-    return static_cast<int>(cargoList.size() + urgentCargoList.size());
+    return static_cast<int>(cargoList.size() + urgentCargoRegistry.getList().size());
 }
 
 // Очистить все грузы и пассажиров
 void Aircraft::clearAll() {
     cargoList.clear();
-    urgentCargoList.clear();
+    urgentCargoRegistry.clear();
     passengerList.clear();
 }
 
@@ -244,7 +239,7 @@ std::string Aircraft::toString() const {
     oss << "  Current Payload: " << std::fixed << std::setprecision(2) << getCurrentPayload() << " kg" << std::endl;
     oss << "  Available Capacity: " << std::fixed << std::setprecision(2) << getAvailableCapacity() << " kg" << std::endl;
     oss << "  Cargo: " << cargoList.size() << " items" << std::endl;
-    oss << "  Urgent Cargo: " << urgentCargoList.size() << " items" << std::endl;
+    oss << "  Urgent Cargo: " << urgentCargoRegistry.getList().size() << " items" << std::endl;
     oss << "  Passengers: " << passengerList.size() << " people" << std::endl;
     
     return oss.str();
@@ -255,28 +250,32 @@ bool Aircraft::isValid() const {
     return !aircraftNumber.empty() && maxPayload > 0;
 }
 
-// Получить просроченные срочные грузы
+// Получить просроченные срочные грузы (момент читается один раз на весь список)
 std::vector<std::shared_ptr<UrgentCargo>> Aircraft::getOverdueCargo() const {
-    std::vector<std::shared_ptr<UrgentCargo>> overdueCargo;
-    
-    for (const auto& urgentCargo : urgentCargoList) {
-        if (urgentCargo && urgentCargo->isOverdue()) {
-            overdueCargo.push_back(urgentCargo);
-        }
-    }
-    
-    return overdueCargo;
+    return getOverdueCargo(std::time(nullptr));
 }
 
-// Получить срочные грузы
+// Получить грузы, просроченные на момент now (в порядке сроков)
+std::vector<std::shared_ptr<UrgentCargo>> Aircraft::getOverdueCargo(std::time_t now) const {
+    return urgentCargoRegistry.getOverdue(now);
+}
+
+// Получить срочные грузы (момент читается один раз на весь список)
 std::vector<std::shared_ptr<UrgentCargo>> Aircraft::getUrgentCargo() const {
-    std::vector<std::shared_ptr<UrgentCargo>> urgentCargo;
-    
-    for (const auto& cargo : urgentCargoList) {
-        if (cargo && cargo->isUrgent()) {
-            urgentCargo.push_back(cargo);
-        }
-    }
-    
-    return urgentCargo;
+    return getUrgentCargo(std::time(nullptr));
+}
+
+// Получить грузы, срочные на момент now (в порядке сроков)
+std::vector<std::shared_ptr<UrgentCargo>> Aircraft::getUrgentCargo(std::time_t now) const {
+    return urgentCargoRegistry.getUrgent(now);
+}
+
+// Подключить общий индекс сроков сети
+void Aircraft::setDeadlineIndex(std::shared_ptr<CargoDeadlineIndex> index) {
+    urgentCargoRegistry.setNetworkIndex(std::move(index));
+}
+
+// Получить подключённый общий индекс сроков
+std::shared_ptr<CargoDeadlineIndex> Aircraft::getDeadlineIndex() const {
+    return urgentCargoRegistry.getNetworkIndex();
 }
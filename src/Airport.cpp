@@ -3,19 +3,20 @@
 #include <sstream>
 #include <algorithm>
 #include <iomanip>
+#include <utility>
 
 // Конструктор по умолчанию
-Airport::Airport() : name("") {
+Airport::Airport() : name(""), urgentCargoRegistry("Airport ") {
 }
 
 // Конструктор с параметрами
-Airport::Airport(const std::string& airportName) : name(airportName) {
+Airport::Airport(const std::string& airportName) : name(airportName), urgentCargoRegistry("Airport " + airportName) {
 }
 
 // Конструктор копирования
 Airport::Airport(const Airport& other) 
     : name(other.name), cargoList(other.cargoList), 
-      urgentCargoList(other.urgentCargoList), passengerList(other.passengerList),
+      urgentCargoRegistry(other.urgentCargoRegistry), passengerList(other.passengerList),
       aircraftList(other.aircraftList) {
 }
 
@@ -24,7 +25,7 @@ Airport& Airport::operator=(const Airport& other) {
     if (this != &other) {
         name = other.name;
         cargoList = other.cargoList;
-        urgentCargoList = other.urgentCargoList;
+        urgentCargoRegistry = other.urgentCargoRegistry;
         passengerList = other.passengerList;
         aircraftList = other.aircraftList;
     }
@@ -33,7 +34,7 @@ Airport& Airport::operator=(const Airport& other) {
 
 // Деструктор
 Airport::~Airport() {
-    // Деструктор пустой, так как мы используем shared_ptr
+    // Деструктор пустой: записи в общем индексе удаляет реестр срочных грузов
 }
 
 // Геттеры
@@ -46,7 +47,7 @@ const std::vector<std::shared_ptr<Cargo>>& Airport::getCargoList() const {
 }
 
 const std::vector<std::shared_ptr<UrgentCargo>>& Airport::getUrgentCargoList() const {
-    return urgentCargoList;
+    return urgentCargoRegistry.getList();
 }
 
 const std::vector<std::shared_ptr<Passenger>>& Airport::getPassengerList() const {
@@ -60,6 +61,7 @@ const std::vector<std::shared_ptr<Aircraft>>& Airport::getAircraftList() const {
 // Сеттеры
 void Airport::setName(const std::string& airportName) {
     name = airportName;
+    urgentCargoRegistry.setLocation("Airport " + airportName);
 }
 
 // Методы для работы с грузами
@@ -71,7 +73,7 @@ void Airport::addCargo(std::shared_ptr<Cargo> cargo) {
 
 void Airport::addUrgentCargo(std::shared_ptr<UrgentCargo> urgentCargo) {
     if (urgentCargo && urgentCargo->isValid()) {
-        urgentCargoList.push_back(urgentCargo);
+        urgentCargoRegistry.add(std::move(urgentCargo));
     }
 }
 
@@ -86,13 +88,7 @@ void Airport::removeCargo(const std::string& cargoNumber) {
 }
 
 void Airport::removeUrgentCargo(const std::string& cargoNumber) {
-    urgentCargoList.erase(
-        std::remove_if(urgentCargoList.begin(), urgentCargoList.end(),
-            [&cargoNumber](const std::shared_ptr<UrgentCargo>& cargo) {
-                return cargo && cargo->getCargoNumber() == cargoNumber;
-            }),
-        urgentCargoList.end()
-    );
+    urgentCargoRegistry.remove(cargoNumber);
 }
 
 std::shared_ptr<Cargo> Airport::findCargo(const std::string& cargoNumber) const {
@@ -105,12 +101,7 @@ std::shared_ptr<Cargo> Airport::findCargo(const std::string& cargoNumber) const
 }
 
 std::shared_ptr<UrgentCargo> Airport::findUrgentCargo(const std::string& cargoNumber) const {
-    auto it = std::find_if(urgentCargoList.begin(), urgentCargoList.end(),
-        [&cargoNumber](const std::shared_ptr<UrgentCargo>& cargo) {
-            return cargo && cargo->getCargoNumber() == cargoNumber;
-        });
-    
-    return (it != urgentCargoList.end()) ? *it : nullptr;
+    return urgentCargoRegistry.find(cargoNumber);
 }
 
 // Методы для работы с пассажирами
@@ -177,7 +168,7 @@ double Airport::getTotalCargoWeight() const {
     }
     
     // Добавляем вес срочных грузов
-    for (const auto& urgentCargo : urgentCargoList) {
+    for (const auto& urgentCargo : urgentCargoRegistry.getList()) {
         if (urgentCargo) {
             totalWeight += urgentCargo->getMass();
         }
@@ -208,7 +199,7 @@ std::string Airport::toString() const {
     std::ostringstream oss;
     oss << "Airport: " << name << std::endl;
     oss << "  Cargo: " << cargoList.size() << " items" << std::endl;
-    oss << "  Urgent Cargo: " << urgentCargoList.size() << " items" << std::endl;
+    oss << "  Urgent Cargo: " << urgentCargoRegistry.getList().size() << " items" << std::endl;
     oss << "  Passengers: " << passengerList.size() << " people" << std::endl;
     oss << "  Aircraft: " << aircraftList.size() << " planes" << std::endl;
     oss << "  Total Weight: " << std::fixed << std::setprecision(2) << getTotalCargoWeight() << " kg" << std::endl;
@@ -221,28 +212,32 @@ bool Airport::isValid() const {
     return !name.empty();
 }
 
-// Получить просроченные срочные грузы
+// Получить просроченные срочные грузы (момент читается один раз на весь список)
 std::vector<std::shared_ptr<UrgentCargo>> Airport::getOverdueCargo() const {
-    std::vector<std::shared_ptr<UrgentCargo>> overdueCargo;
-    
-    for (const auto& urgentCargo : urgentCargoList) {
-        if (urgentCargo && urgentCargo->isOverdue()) {
-            overdueCargo.push_back(urgentCargo);
-        }
-    }
-    
-    return overdueCargo;
+    return getOverdueCargo(std::time(nullptr));
+}
+
+// Получить грузы, просроченные на момент now (в порядке сроков)
+std::vector<std::shared_ptr<UrgentCargo>> Airport::getOverdueCargo(std::time_t now) const {
+    return urgentCargoRegistry.getOverdue(now);
 }
 
-// Получить срочные грузы
+// Получить срочные грузы (момент читается один раз на весь список)
 std::vector<std::shared_ptr<UrgentCargo>> Airport::getUrgentCargo() const {
-    std::vector<std::shared_ptr<UrgentCargo>> urgentCargo;
-    
-    for (const auto& cargo : urgentCargoList) {
-        if (cargo && cargo->isUrgent()) {
-            urgentCargo.push_back(cargo);
-        }
-    }
-    
-    return urgentCargo;
+    return getUrgentCargo(std::time(nullptr));
+}
+
+// Получить грузы, срочные на момент now (в порядке сроков)
+std::vector<std::shared_ptr<UrgentCargo>> Airport::getUrgentCargo(std::time_t now) const {
+    return urgentCargoRegistry.getUrgent(now);
+}
+
+// Подключить общий индекс сроков сети
+void Airport::setDeadlineIndex(std::shared_ptr<CargoDeadlineIndex> index) {
+    urgentCargoRegistry.setNetworkIndex(std::move(index));
+}
+
+// Получить подключённый общий индекс сроков
+std::shared_ptr<CargoDeadlineIndex> Airport::getDeadlineIndex() const {
+    return urgentCargoRegistry.getNetworkIndex();
 }
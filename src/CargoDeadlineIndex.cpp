@@ -0,0 +1,73 @@
+#include "CargoDeadlineIndex.h"
+#include <limits>
+
+// Добавить груз в индекс
+bool CargoDeadlineIndex::add(std::shared_ptr<UrgentCargo> cargo, const void* holder, const std::string& location) {
+    if (!cargo || cargo->getDeadline() == 0) {
+        return false;
+    }
+    std::time_t deadline = cargo->getDeadline();
+    entries.emplace(deadline, CargoDeadlineEntry{std::move(cargo), holder, location});
+    return true;
+}
+
+// Убрать запись груза данного владельца
+// Сначала ищем среди записей с текущим сроком груза, затем (если срок менялся) перебором
+bool CargoDeadlineIndex::remove(const UrgentCargo* cargo, const void* holder) {
+    if (!cargo) return false;
+
+    auto matches = [cargo, holder](const std::pair<const std::time_t, CargoDeadlineEntry>& entry) {
+        return entry.second.cargo.get() == cargo && entry.second.holder == holder;
+    };
+
+    auto range = entries.equal_range(cargo->getDeadline());
+    for (auto it = range.first; it != range.second; ++it) {
+        if (matches(*it)) {
+            entries.erase(it);
+            return true;
+        }
+    }
+    for (auto it = entries.begin(); it != entries.end(); ++it) {
+        if (matches(*it)) {
+            entries.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Убрать все записи
+void CargoDeadlineIndex::clear() {
+    entries.clear();
+}
+
+// Количество записей
+size_t CargoDeadlineIndex::size() const {
+    return entries.size();
+}
+
+// Записи со сроком в [from, to)
+std::vector<CargoDeadlineEntry> CargoDeadlineIndex::collect(std::time_t from, std::time_t to) const {
+    std::vector<CargoDeadlineEntry> result;
+    if (to <= from) return result;
+    auto end = entries.lower_bound(to);
+    for (auto it = entries.lower_bound(from); it != end; ++it) {
+        result.push_back(it->second);
+    }
+    return result;
+}
+
+// Просроченные грузы: now > срока
+std::vector<CargoDeadlineEntry> CargoDeadlineIndex::getOverdue(std::time_t now) const {
+    return collect(std::numeric_limits<std::time_t>::min(), now);
+}
+
+// Срочные грузы: до срока меньше 24 часов (просроченные тоже срочные)
+std::vector<CargoDeadlineEntry> CargoDeadlineIndex::getUrgent(std::time_t now) const {
+    return collect(std::numeric_limits<std::time_t>::min(), now + URGENT_WINDOW);
+}
+
+// Грузы со сроком в [from, to): просроченные на момент to, но не на момент from
+std::vector<CargoDeadlineEntry> CargoDeadlineIndex::getDueInRange(std::time_t from, std::time_t to) const {
+    return collect(from, to);
+}
@@ -0,0 +1,29 @@
+#include "Clock.h"
+
+// Деструктор
+Clock::~Clock() {
+}
+
+// Системное время
+std::time_t SystemClock::now() const {
+    return std::time(nullptr);
+}
+
+// Ручные часы с заданным начальным моментом
+ManualClock::ManualClock(std::time_t time) : current(time) {
+}
+
+// Текущий момент ручных часов
+std::time_t ManualClock::now() const {
+    return current;
+}
+
+// Установить текущий момент
+void ManualClock::setTime(std::time_t time) {
+    current = time;
+}
+
+// Сдвинуть часы
+void ManualClock::advance(std::time_t seconds) {
+    current += seconds;
+}
@@ -0,0 +1,135 @@
+#include "ConcurrentSchedule.h"
+
+// Конструктор
+ConcurrentSchedule::ConcurrentSchedule() {
+}
+
+// Разделяемая блокировка: сначала дождаться писателя, который ждёт или держит исключительную
+std::shared_lock<std::shared_mutex> ConcurrentSchedule::lockShared() const {
+    {
+        std::lock_guard<std::mutex> gate(writerGate);
+    }
+    return std::shared_lock<std::shared_mutex>(mutex);
+}
+
+// Исключительная блокировка: пока писатель ждёт читателей, writerGate не пускает новых
+std::unique_lock<std::shared_mutex> ConcurrentSchedule::lockExclusive() {
+    std::lock_guard<std::mutex> gate(writerGate);
+    return std::unique_lock<std::shared_mutex>(mutex);
+}
+
+// Копия рейса: читатель не должен держать рейс, который писатель меняет на месте
+std::shared_ptr<Flight> ConcurrentSchedule::copyFlight(const std::shared_ptr<Flight>& flight) {
+    return flight ? std::make_shared<Flight>(*flight) : nullptr;
+}
+
+// Копии рейсов участка
+std::vector<std::shared_ptr<Flight>> ConcurrentSchedule::copyFlights(const FlightRange& range) {
+    std::vector<std::shared_ptr<Flight>> result;
+    result.reserve(range.size());
+    for (const auto& flight : range) {
+        result.push_back(copyFlight(flight));
+    }
+    return result;
+}
+
+// Добавить рейс
+bool ConcurrentSchedule::addFlight(std::shared_ptr<Flight> flight) {
+    std::unique_lock<std::shared_mutex> lock = lockExclusive();
+    return schedule.addFlight(std::move(flight));
+}
+
+// Добавить пачку рейсов: одно слияние в одной исключительной секции
+int ConcurrentSchedule::addFlights(const std::vector<std::shared_ptr<Flight>>& newFlights,
+                                   std::vector<FlightCheckStatus>* statuses) {
+    std::unique_lock<std::shared_mutex> lock = lockExclusive();
+    return schedule.addFlights(newFlights, statuses);
+}
+
+// Удалить рейс
+void ConcurrentSchedule::removeFlight(const std::string& flightNumber) {
+    std::unique_lock<std::shared_mutex> lock = lockExclusive();
+    schedule.removeFlight(flightNumber);
+}
+
+// Добавить рейс, только если нет конфликтов (проверка и вставка в одной секции)
+FlightCheckResult ConcurrentSchedule::tryAddFlight(std::shared_ptr<Flight> flight) {
+    std::unique_lock<std::shared_mutex> lock = lockExclusive();
+    return schedule.tryAddFlight(std::move(flight));
+}
+
+// Перенести рейс
+FlightCheckResult ConcurrentSchedule::rescheduleFlight(const std::string& flightNumber, std::time_t newDeparture,
+                                                       std::time_t newArrival, bool rejectConflicts) {
+    std::unique_lock<std::shared_mutex> lock = lockExclusive();
+    return schedule.rescheduleFlight(flightNumber, newDeparture, newArrival, rejectConflicts);
+}
+
+// Завершить рейс
+void ConcurrentSchedule::completeFlight(const std::string& flightNumber) {
+    std::unique_lock<std::shared_mutex> lock = lockExclusive();
+    schedule.completeFlight(flightNumber);
+}
+
+// Найти рейс по номеру
+std::shared_ptr<Flight> ConcurrentSchedule::findFlight(const std::string& flightNumber) const {
+    std::shared_lock<std::shared_mutex> lock = lockShared();
+    return copyFlight(schedule.findFlight(flightNumber));
+}
+
+// Рейсы с вылетом в [startTime, endTime]
+std::vector<std::shared_ptr<Flight>> ConcurrentSchedule::getFlightsInTimeRange(std::time_t startTime,
+                                                                               std::time_t endTime) const {
+    std::shared_lock<std::shared_mutex> lock = lockShared();
+    return copyFlights(schedule.getFlightsInTimeRange(startTime, endTime));
+}
+
+// Рейсы самолёта с вылетом в [startTime, endTime]
+std::vector<std::shared_ptr<Flight>> ConcurrentSchedule::getFlightsByAircraftInRange(const std::string& aircraftId,
+                                                                                     std::time_t startTime,
+                                                                                     std::time_t endTime) const {
+    std::shared_lock<std::shared_mutex> lock = lockShared();
+    return copyFlights(schedule.getFlightsByAircraftInRange(aircraftId, startTime, endTime));
+}
+
+// Проверить рейс на конфликты
+FlightCheckResult ConcurrentSchedule::checkFlight(const Flight& flight) const {
+    std::shared_lock<std::shared_mutex> lock = lockShared();
+    return schedule.checkFlight(flight);
+}
+
+// Изменения после версии
+bool ConcurrentSchedule::getChangesSince(std::uint64_t sinceVersion, std::vector<ScheduleChange>& changes,
+                                         size_t maxChanges) const {
+    std::shared_lock<std::shared_mutex> lock = lockShared();
+    return schedule.getChangesSince(sinceVersion, changes, maxChanges);
+}
+
+// Текущая версия расписания
+std::uint64_t ConcurrentSchedule::getVersion() const {
+    std::shared_lock<std::shared_mutex> lock = lockShared();
+    return schedule.getVersion();
+}
+
+// Общее количество рейсов
+int ConcurrentSchedule::getTotalFlights() const {
+    std::shared_lock<std::shared_mutex> lock = lockShared();
+    return schedule.getTotalFlights();
+}
+
+// Проверить корректность расписания
+bool ConcurrentSchedule::isValid() const {
+    std::shared_lock<std::shared_mutex> lock = lockShared();
+    return schedule.isValid();
+}
+
+// Счётчики статусов: писатели исключены, трекер продвигается под мьютексом расписания
+ConcurrentSchedule::StatusCounts ConcurrentSchedule::getStatusCounts() const {
+    std::shared_lock<std::shared_mutex> lock = lockShared();
+    StatusCounts counts;
+    counts.total = schedule.getTotalFlights();
+    counts.scheduled = schedule.getScheduledFlights();
+    counts.inProgress = schedule.getInProgressFlights();
+    counts.completed = schedule.getCompletedFlights();
+    return counts;
+}
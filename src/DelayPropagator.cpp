@@ -0,0 +1,95 @@
+#include "DelayPropagator.h"
+#include <limits>
+
+// Конструктор
+DelayPropagator::DelayPropagator(Schedule& schedule)
+    : schedule(schedule), horizon(DEFAULT_HORIZON), respectGroundTime(true) {
+}
+
+// Горизонт сдвига
+void DelayPropagator::setHorizon(std::time_t seconds) {
+    horizon = seconds > 0 ? seconds : 0;
+}
+
+std::time_t DelayPropagator::getHorizon() const {
+    return horizon;
+}
+
+// Учёт минимальной стоянки
+void DelayPropagator::setRespectGroundTime(bool respect) {
+    respectGroundTime = respect;
+}
+
+bool DelayPropagator::isRespectingGroundTime() const {
+    return respectGroundTime;
+}
+
+// Рассчитать сдвиги рейсов самолёта после задержки рейса на delay секунд
+// Рейсы самолёта берутся участком упорядоченного списка начиная с вылета
+// задержанного рейса; просмотр идёт до первого рейса, которому сдвиг не нужен.
+DelayPropagationResult DelayPropagator::computeDelay(const std::string& flightNumber, std::time_t delay) const {
+    DelayPropagationResult result{FlightCheckStatus::Ok, "", {}};
+    std::shared_ptr<Flight> delayed = schedule.findFlight(flightNumber);
+    if (!delayed) {
+        result.status = FlightCheckStatus::NotFound;
+        return result;
+    }
+    if (delay < 0) {
+        result.status = FlightCheckStatus::InvalidFlight;
+        return result;
+    }
+    if (delay == 0) {
+        return result;
+    }
+    
+    std::time_t departure = delayed->getDepartureTime();
+    std::time_t limit = horizon > 0 ? departure + horizon : std::numeric_limits<std::time_t>::max();
+    result.changes.push_back({flightNumber, departure, departure + delay,
+                              delayed->getArrivalTime(), delayed->getArrivalTime() + delay});
+    
+    const std::string& aircraftId = delayed->getAircraftId();
+    FlightRange rotation = schedule.getFlightsByAircraftInRange(aircraftId, departure,
+                                                                std::numeric_limits<std::time_t>::max());
+    const Flight* previous = nullptr;
+    for (const auto& flight : rotation) {
+        if (!previous) {
+            if (flight.get() == delayed.get()) {
+                previous = flight.get();
+            }
+            continue;
+        }
+        std::time_t previousArrival = result.changes.back().newArrival;
+        std::time_t required = previousArrival;
+        if (respectGroundTime) {
+            required += schedule.getRequiredGroundTime(aircraftId, previous->getDestinationAirport());
+        }
+        if (flight->getDepartureTime() >= required) {
+            break;  // Запаса хватает: дальше сдвигов нет
+        }
+        if (flight->getDepartureTime() >= limit) {
+            result.status = flight->getDepartureTime() < previousArrival ? FlightCheckStatus::Overlap
+                                                                         : FlightCheckStatus::Turnaround;
+            result.conflictingFlight = flight->getFlightNumber();
+            break;
+        }
+        std::time_t shift = required - flight->getDepartureTime();
+        result.changes.push_back({flight->getFlightNumber(), flight->getDepartureTime(), required,
+                                  flight->getArrivalTime(), flight->getArrivalTime() + shift});
+        previous = flight.get();
+    }
+    return result;
+}
+
+// Рассчитать и применить сдвиги
+// Рейсы переносятся с конца цепочки, поэтому каждый перенос идёт на уже
+// освобождённое место; перенос стоит O(log n) плюс сдвиг участка списка.
+DelayPropagationResult DelayPropagator::applyDelay(const std::string& flightNumber, std::time_t delay) {
+    DelayPropagationResult result = computeDelay(flightNumber, delay);
+    if (result.status == FlightCheckStatus::NotFound || result.status == FlightCheckStatus::InvalidFlight) {
+        return result;
+    }
+    for (auto it = result.changes.rbegin(); it != result.changes.rend(); ++it) {
+        schedule.rescheduleFlight(it->flightNumber, it->newDeparture, it->newArrival, false);
+    }
+    return result;
+}
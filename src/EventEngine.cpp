@@ -0,0 +1,203 @@
+#include "EventEngine.h"
+#include <algorithm>
+#include <iterator>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// Номер младшего установленного бита (value != 0)
+static int lowestBit(std::uint64_t value) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(value);
+#endif
+}
+
+// Номер старшего установленного бита (value != 0)
+static int highestBit(std::uint64_t value) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<int>(index);
+#else
+    return 63 - __builtin_clzll(value);
+#endif
+}
+
+// Конструктор
+EventEngine::EventEngine(std::time_t now)
+    : occupied(), current(toWheelTime(now)), nextId(1), queueEnabled(false), cancelledCount(0) {
+}
+
+// Сдвиг на 2^63 сохраняет порядок отрицательных и положительных моментов
+std::uint64_t EventEngine::toWheelTime(std::time_t time) {
+    return static_cast<std::uint64_t>(static_cast<long long>(time)) ^ (1ULL << 63);
+}
+
+std::time_t EventEngine::fromWheelTime(std::uint64_t time) {
+    return static_cast<std::time_t>(static_cast<long long>(time ^ (1ULL << 63)));
+}
+
+// Уровень таймера — старший разряд, в котором срок отличается от текущего момента;
+// на своём уровне таймер всегда лежит в ячейке правее ячейки текущего момента
+void EventEngine::place(const Timer& timer) {
+    int level = highestBit(timer.due ^ current) / LEVEL_BITS;
+    int slot = static_cast<int>((timer.due >> (level * LEVEL_BITS)) & (SLOTS - 1));
+    slots[level][slot].push_back(timer);
+    occupied[level] |= 1ULL << slot;
+}
+
+// Поставить событие на момент dueTime
+EventEngine::TimerId EventEngine::schedule(std::time_t dueTime, ScheduleEvent event) {
+    std::uint64_t due = toWheelTime(dueTime);
+    if (due <= current) {
+        return 0;  // Момент уже наступил
+    }
+    TimerId id = nextId++;
+    pending.emplace(id, std::move(event));
+    place(Timer{due, id});
+    return id;
+}
+
+// Отменить таймер: запись в колесе остаётся и отбрасывается при срабатывании
+// или при очистке колеса, когда отменённых записей больше, чем действующих
+bool EventEngine::cancel(TimerId id) {
+    if (pending.erase(id) == 0) {
+        return false;
+    }
+    ++cancelledCount;
+    if (cancelledCount >= COMPACT_MIN_CANCELLED && cancelledCount > pending.size()) {
+        compact();
+    }
+    return true;
+}
+
+// Убрать отменённые таймеры из всех ячеек; опустевшие ячейки снимаются с масок
+void EventEngine::compact() {
+    for (int level = 0; level < LEVELS; ++level) {
+        std::uint64_t mask = occupied[level];
+        while (mask != 0) {
+            int slot = lowestBit(mask);
+            mask &= mask - 1;
+            std::vector<Timer>& timers = slots[level][slot];
+            timers.erase(std::remove_if(timers.begin(), timers.end(),
+                                        [this](const Timer& timer) { return pending.find(timer.id) == pending.end(); }),
+                         timers.end());
+            if (timers.empty()) {
+                std::vector<Timer>().swap(timers);
+                occupied[level] &= ~(1ULL << slot);
+            }
+        }
+    }
+    cancelledCount = 0;
+}
+
+// Продвинуть часы
+// На каждом шаге берётся ближайшая занятая ячейка самого нижнего непустого уровня:
+// ячейка уровня 0 срабатывает целиком, ячейка уровня L > 0 раскладывается по нижним
+// уровням относительно начала своего интервала (таймеры с этим сроком срабатывают сразу).
+size_t EventEngine::advanceTo(std::time_t time) {
+    std::uint64_t target = toWheelTime(time);
+    if (target <= current) {
+        return 0;
+    }
+
+    std::vector<ScheduleEvent> batch;
+    std::vector<Timer> due;
+    while (true) {
+        int level = 0;
+        while (level < LEVELS && occupied[level] == 0) {
+            ++level;
+        }
+        if (level == LEVELS) break;
+
+        int slot = lowestBit(occupied[level]);
+        int blockBits = (level + 1) * LEVEL_BITS;
+        std::uint64_t blockStart = blockBits >= 64 ? 0 : (current & ~((1ULL << blockBits) - 1));
+        std::uint64_t slotStart = blockStart | (static_cast<std::uint64_t>(slot) << (level * LEVEL_BITS));
+        if (slotStart > target) break;
+
+        current = slotStart;
+        std::vector<Timer> timers;
+        timers.swap(slots[level][slot]);
+        occupied[level] &= ~(1ULL << slot);
+
+        due.clear();
+        for (const Timer& timer : timers) {
+            if (pending.find(timer.id) == pending.end()) {  // Отменён
+                --cancelledCount;
+                continue;
+            }
+            if (timer.due == current) {
+                due.push_back(timer);
+            } else {
+                place(timer);
+            }
+        }
+        // Таймеры с равным сроком срабатывают в порядке постановки
+        std::sort(due.begin(), due.end(), [](const Timer& a, const Timer& b) { return a.id < b.id; });
+        for (const Timer& timer : due) {
+            auto it = pending.find(timer.id);
+            batch.push_back(std::move(it->second));
+            pending.erase(it);
+        }
+    }
+    current = target;
+
+    if (!batch.empty()) {
+        for (const auto& listener : listeners) {
+            listener(batch);
+        }
+        if (queueEnabled) {
+            queue.insert(queue.end(), batch.begin(), batch.end());
+        }
+    }
+    return batch.size();
+}
+
+// Текущий момент часов движка
+std::time_t EventEngine::getTime() const {
+    return fromWheelTime(current);
+}
+
+// Число ожидающих таймеров
+size_t EventEngine::getPendingCount() const {
+    return pending.size();
+}
+
+// Число записей в ячейках колеса
+size_t EventEngine::getWheelSize() const {
+    return pending.size() + cancelledCount;
+}
+
+// Добавить слушателя
+void EventEngine::addListener(EventCallback callback) {
+    if (callback) {
+        listeners.push_back(std::move(callback));
+    }
+}
+
+// Включить или выключить очередь для опроса
+void EventEngine::setQueueEnabled(bool enabled) {
+    queueEnabled = enabled;
+    if (!enabled) {
+        queue.clear();
+    }
+}
+
+// Забрать события из очереди
+std::vector<ScheduleEvent> EventEngine::poll(size_t maxEvents) {
+    size_t count = std::min(maxEvents, queue.size());
+    std::vector<ScheduleEvent> result(std::make_move_iterator(queue.begin()),
+                                      std::make_move_iterator(queue.begin() + count));
+    queue.erase(queue.begin(), queue.begin() + count);
+    return result;
+}
+
+// Число событий в очереди
+size_t EventEngine::getQueuedCount() const {
+    return queue.size();
+}
@@ -116,17 +116,25 @@ double Flight::getFlightDurationHours() const {
 
 // Проверить, идёт ли рейс сейчас
 bool Flight::isInProgress() const {
+    return isInProgress(std::time(nullptr));
+}
+
+// Проверить, идёт ли рейс в момент now
+bool Flight::isInProgress(std::time_t now) const {
     if (completed) return false;
     
-    std::time_t now = std::time(nullptr);
     return now >= departureTime && now <= arrivalTime;
 }
 
 // Проверить, запланирован ли рейс
 bool Flight::isScheduled() const {
+    return isScheduled(std::time(nullptr));
+}
+
+// Проверить, запланирован ли рейс на момент now
+bool Flight::isScheduled(std::time_t now) const {
     if (completed) return false;
     
-    std::time_t now = std::time(nullptr);
     return now < departureTime;
 }
 
@@ -171,6 +179,11 @@ void Flight::unloadCargoAndPassengers(std::shared_ptr<Aircraft> aircraft) const
 
 // Получить строковое представление объекта
 std::string Flight::toString() const {
+    return toString(std::time(nullptr));
+}
+
+// Получить строковое представление объекта со статусом на момент now
+std::string Flight::toString(std::time_t now) const {
     std::ostringstream oss;
     oss << "Flight #" << flightNumber << std::endl;
     oss << "  Route: " << departureAirport << " -> " << destinationAirport << std::endl;
@@ -198,9 +211,9 @@ std::string Flight::toString() const {
     oss << "  Status: ";
     if (completed) {
         oss << "Completed";
-    } else if (isInProgress()) {
+    } else if (isInProgress(now)) {
         oss << "In Progress";
-    } else if (isScheduled()) {
+    } else if (isScheduled(now)) {
         oss << "Scheduled";
     } else {
         oss << "Unknown";
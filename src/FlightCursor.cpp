@@ -0,0 +1,74 @@
+#include "FlightCursor.h"
+
+// Конструктор
+FlightCursor::FlightCursor(const Schedule& schedule, FlightCursorFilter filter)
+    : schedule(schedule), filter(std::move(filter)), finished(false),
+      openVersion(schedule.getVersion()), readVersion(openVersion) {
+    resumeTime = this->filter.startTime;
+}
+
+// Участок списка для продолжения обхода: список самолёта или аэропорта короче общего
+FlightRange FlightCursor::source(std::time_t from) const {
+    if (!filter.aircraftId.empty()) {
+        return schedule.getFlightsByAircraftInRange(filter.aircraftId, from, filter.endTime);
+    }
+    if (!filter.airportCode.empty()) {
+        return schedule.getFlightsByAirportInRange(filter.airportCode, from, filter.endTime);
+    }
+    return schedule.getFlightsInTimeRange(from, filter.endTime);
+}
+
+// Следующий пакет рейсов в порядке вылета
+// Рейсы с вылетом resumeTime, уже выданные ранее, пропускаются по номеру,
+// поэтому повторный поиск после изменения расписания не дублирует границу пакета.
+size_t FlightCursor::next(std::vector<std::shared_ptr<Flight>>& batch, size_t maxFlights) {
+    batch.clear();
+    if (finished || maxFlights == 0) {
+        return 0;
+    }
+    readVersion = schedule.getVersion();
+    
+    bool filterAirport = !filter.aircraftId.empty() && !filter.airportCode.empty();
+    FlightRange range = source(resumeTime);
+    auto it = range.begin();
+    for (; it != range.end() && batch.size() < maxFlights; ++it) {
+        const Flight& flight = **it;
+        if (flight.getDepartureTime() == resumeTime && resumeNumbers.count(flight.getFlightNumber()) != 0) {
+            continue;
+        }
+        if (filterAirport && flight.getDepartureAirport() != filter.airportCode &&
+            flight.getDestinationAirport() != filter.airportCode) {
+            continue;
+        }
+        batch.push_back(*it);
+        if (flight.getDepartureTime() != resumeTime) {
+            resumeTime = flight.getDepartureTime();
+            resumeNumbers.clear();
+        }
+        resumeNumbers.insert(flight.getFlightNumber());
+    }
+    if (it == range.end()) {
+        finished = true;
+    }
+    return batch.size();
+}
+
+// Все рейсы выданы
+bool FlightCursor::isFinished() const {
+    return finished;
+}
+
+// Версия расписания при открытии
+std::uint64_t FlightCursor::getOpenVersion() const {
+    return openVersion;
+}
+
+// Версия расписания при последнем пакете
+std::uint64_t FlightCursor::getReadVersion() const {
+    return readVersion;
+}
+
+// Расписание изменилось после открытия
+bool FlightCursor::isStale() const {
+    return schedule.getVersion() != openVersion;
+}
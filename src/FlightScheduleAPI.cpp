@@ -7,13 +7,110 @@
 #include "Cargo.h"
 #include "UrgentCargo.h"
 #include "Passenger.h"
+#include "Clock.h"
+#include "EventEngine.h"
+#include "DelayPropagator.h"
+#include "FlightCursor.h"
 #include "FlightScheduleException.h"
 #include <string>
 #include <sstream>
 #include <cstring>
+#include <algorithm>
+#include <unordered_map>
 
 #define BUFFER_SIZE 8192
 
+// Дескриптор объекта модели — указатель на shared_ptr, разделяющий владение
+// с контейнерами (расписанием, самолётом, аэропортом)
+template <typename T>
+static void* makeHandle(std::shared_ptr<T> object) {
+    return new std::shared_ptr<T>(std::move(object));
+}
+
+// Объект, на который указывает дескриптор
+template <typename T>
+static const std::shared_ptr<T>& sharedOf(void* handle) {
+    return *static_cast<std::shared_ptr<T>*>(handle);
+}
+
+// Освободить дескриптор (объект удаляется вместе с последней ссылкой)
+template <typename T>
+static void releaseHandle(void* handle) {
+    delete static_cast<std::shared_ptr<T>*>(handle);
+}
+
+// Рейс для добавления в расписание: свободный рейс (единственная ссылка — сам дескриптор)
+// разделяется с расписанием, а рейс, уже принадлежащий расписанию, копируется.
+// Расписание меняет свои рейсы на месте (перенос, смена самолёта), поэтому общий
+// объект испортил бы упорядочивание и индексы другого расписания.
+static std::shared_ptr<Flight> adoptFlight(void* handle) {
+    const std::shared_ptr<Flight>& flight = sharedOf<Flight>(handle);
+    return flight.use_count() > 1 ? std::make_shared<Flight>(*flight) : flight;
+}
+
+// Скопировать строку в буфер вызывающей стороны с усечением и вернуть её полную длину
+// (буфер может отсутствовать — тогда только длина)
+static int copyString(const std::string& text, char* buffer, int bufferSize) {
+    if (buffer && bufferSize > 0) {
+        strncpy_s(buffer, bufferSize, text.c_str(), _TRUNCATE);
+    }
+    return static_cast<int>(text.size());
+}
+
+// Строка в памяти библиотеки (освобождается FlightSchedule_FreeString)
+static char* allocString(const std::string& text) {
+    char* result = new char[text.size() + 1];
+    std::memcpy(result, text.c_str(), text.size() + 1);
+    return result;
+}
+
+// Ошибки валидации по одной в строке
+static std::string validationErrorsText(const Schedule& schedule) {
+    std::ostringstream oss;
+    for (const auto& error : schedule.getValidationErrors()) {
+        oss << error << "\n";
+    }
+    return oss.str();
+}
+
+// Код записи пакета рейсов по итогу Schedule::addFlights (коды C API не зависят от порядка FlightCheckStatus)
+static int batchRowStatus(FlightCheckStatus status) {
+    switch (status) {
+        case FlightCheckStatus::Ok: return BATCH_ROW_OK;
+        case FlightCheckStatus::DuplicateNumber: return BATCH_ROW_DUPLICATE;
+        default: return BATCH_ROW_INVALID;
+    }
+}
+
+// Отметить записи пакета [from, rowCount) как необработанные (после внутренней ошибки)
+static void failBatchRows(int* statuses, int from, int rowCount) {
+    if (!statuses) return;
+    for (int i = from; i < rowCount; ++i) {
+        statuses[i] = BATCH_ROW_INVALID;
+    }
+}
+
+// Строка таблицы пакета по смещению (nullptr, если смещение вне таблицы или строка не завершена нулём)
+static const char* batchString(const char* strings, int stringsSize, int offset) {
+    if (!strings || offset < 0 || offset >= stringsSize) {
+        return nullptr;
+    }
+    const char* text = strings + offset;
+    return std::memchr(text, '\0', static_cast<size_t>(stringsSize - offset)) ? text : nullptr;
+}
+
+// ============================================
+// Strings API Implementation
+// ============================================
+
+extern "C" {
+
+void FlightSchedule_FreeString(char* text) {
+    delete[] text;
+}
+
+}
+
 // ============================================
 // Schedule API Implementation
 // ============================================
@@ -34,11 +131,148 @@ int Schedule_AddFlight(ScheduleHandle handle, FlightHandle flight) {
     if (!handle || !flight) return 0;
     try {
         auto* schedule = static_cast<Schedule*>(handle);
-        auto* flightPtr = static_cast<Flight*>(flight);
-        auto sharedFlight = std::make_shared<Flight>(*flightPtr);
-        schedule->addFlight(sharedFlight);
-        return 1;
+        return schedule->addFlight(adoptFlight(flight)) ? 1 : 0;
+    } catch (...) {
+        return 0;
+    }
+}
+
+int Schedule_AddFlights(ScheduleHandle handle, const FlightHandle* flights, int count, int* statuses) {
+    if (!handle || !flights || count <= 0) return 0;
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        std::vector<std::shared_ptr<Flight>> batch(static_cast<size_t>(count));
+        for (int i = 0; i < count; ++i) {
+            if (flights[i]) {
+                batch[i] = adoptFlight(flights[i]);
+            }
+        }
+        std::vector<FlightCheckStatus> results;
+        int added = schedule->addFlights(batch, &results);
+        if (statuses) {
+            for (int i = 0; i < count; ++i) {
+                statuses[i] = batchRowStatus(results[i]);
+            }
+        }
+        return added;
+    } catch (...) {
+        failBatchRows(statuses, 0, count);
+        return 0;
+    }
+}
+
+int Schedule_TryAddFlight(ScheduleHandle handle, FlightHandle flight, char* conflictBuffer, int bufferSize) {
+    if (conflictBuffer && bufferSize > 0) conflictBuffer[0] = '\0';
+    if (!handle || !flight) return static_cast<int>(FlightCheckStatus::InvalidFlight);
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        FlightCheckResult result = schedule->tryAddFlight(adoptFlight(flight));
+        if (conflictBuffer && bufferSize > 0) {
+            strncpy_s(conflictBuffer, bufferSize, result.conflictingFlight.c_str(), _TRUNCATE);
+        }
+        return static_cast<int>(result.status);
+    } catch (...) {
+        return static_cast<int>(FlightCheckStatus::InvalidFlight);
+    }
+}
+
+int Schedule_RescheduleFlight(ScheduleHandle handle, const char* flightNumber, long long newDeparture,
+                              long long newArrival, char* conflictBuffer, int bufferSize) {
+    if (conflictBuffer && bufferSize > 0) conflictBuffer[0] = '\0';
+    if (!handle || !flightNumber) return static_cast<int>(FlightCheckStatus::NotFound);
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        FlightCheckResult result = schedule->rescheduleFlight(std::string(flightNumber),
+            static_cast<std::time_t>(newDeparture), static_cast<std::time_t>(newArrival));
+        if (conflictBuffer && bufferSize > 0) {
+            strncpy_s(conflictBuffer, bufferSize, result.conflictingFlight.c_str(), _TRUNCATE);
+        }
+        return static_cast<int>(result.status);
+    } catch (...) {
+        return static_cast<int>(FlightCheckStatus::InvalidFlight);
+    }
+}
+
+int Schedule_ReassignAircraft(ScheduleHandle handle, const char* flightNumber, const char* aircraftId,
+                              char* conflictBuffer, int bufferSize) {
+    if (conflictBuffer && bufferSize > 0) conflictBuffer[0] = '\0';
+    if (!handle || !flightNumber) return static_cast<int>(FlightCheckStatus::NotFound);
+    if (!aircraftId) return static_cast<int>(FlightCheckStatus::InvalidFlight);
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        FlightCheckResult result = schedule->reassignAircraft(std::string(flightNumber), std::string(aircraftId));
+        if (conflictBuffer && bufferSize > 0) {
+            strncpy_s(conflictBuffer, bufferSize, result.conflictingFlight.c_str(), _TRUNCATE);
+        }
+        return static_cast<int>(result.status);
+    } catch (...) {
+        return static_cast<int>(FlightCheckStatus::InvalidFlight);
+    }
+}
+
+int Schedule_PropagateDelay(ScheduleHandle handle, const char* flightNumber, long long delay,
+                            long long horizon, int respectGroundTime, int apply,
+                            FlightDelayRecord* changes, int maxChanges, int* changeCount,
+                            char* conflictBuffer, int bufferSize) {
+    if (changeCount) *changeCount = 0;
+    if (conflictBuffer && bufferSize > 0) conflictBuffer[0] = '\0';
+    if (!handle || !flightNumber) return static_cast<int>(FlightCheckStatus::NotFound);
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        DelayPropagator propagator(*schedule);
+        propagator.setHorizon(static_cast<std::time_t>(horizon));
+        propagator.setRespectGroundTime(respectGroundTime != 0);
+        DelayPropagationResult result = apply
+            ? propagator.applyDelay(std::string(flightNumber), static_cast<std::time_t>(delay))
+            : propagator.computeDelay(std::string(flightNumber), static_cast<std::time_t>(delay));
+        
+        if (changeCount) *changeCount = static_cast<int>(result.changes.size());
+        if (changes) {
+            for (int i = 0; i < maxChanges && i < static_cast<int>(result.changes.size()); ++i) {
+                const FlightDelayChange& change = result.changes[i];
+                strncpy_s(changes[i].flightNumber, sizeof(changes[i].flightNumber), change.flightNumber.c_str(), _TRUNCATE);
+                changes[i].oldDeparture = static_cast<long long>(change.oldDeparture);
+                changes[i].newDeparture = static_cast<long long>(change.newDeparture);
+                changes[i].oldArrival = static_cast<long long>(change.oldArrival);
+                changes[i].newArrival = static_cast<long long>(change.newArrival);
+            }
+        }
+        if (conflictBuffer && bufferSize > 0) {
+            strncpy_s(conflictBuffer, bufferSize, result.conflictingFlight.c_str(), _TRUNCATE);
+        }
+        return static_cast<int>(result.status);
+    } catch (...) {
+        return static_cast<int>(FlightCheckStatus::InvalidFlight);
+    }
+}
+
+int Schedule_AddFlightsBatch(ScheduleHandle handle, const FlightRow* rows, int rowCount,
+                             const char* strings, int stringsSize, int* statuses) {
+    if (!handle || !rows || rowCount <= 0) return 0;
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        std::vector<std::shared_ptr<Flight>> batch(static_cast<size_t>(rowCount));
+        for (int i = 0; i < rowCount; ++i) {
+            const char* number = batchString(strings, stringsSize, rows[i].flightNumber);
+            const char* departure = batchString(strings, stringsSize, rows[i].departureAirport);
+            const char* destination = batchString(strings, stringsSize, rows[i].destinationAirport);
+            const char* aircraft = batchString(strings, stringsSize, rows[i].aircraftId);
+            if (number && departure && destination && aircraft) {
+                batch[i] = std::make_shared<Flight>(number, departure, destination,
+                    static_cast<std::time_t>(rows[i].departureTime), static_cast<std::time_t>(rows[i].arrivalTime), aircraft);
+            }
+        }
+        // Рейсы без строк остаются nullptr и получают статус InvalidFlight
+        std::vector<FlightCheckStatus> results;
+        int added = schedule->addFlights(batch, &results);
+        if (statuses) {
+            for (int i = 0; i < rowCount; ++i) {
+                statuses[i] = batchRowStatus(results[i]);
+            }
+        }
+        return added;
     } catch (...) {
+        failBatchRows(statuses, 0, rowCount);
         return 0;
     }
 }
@@ -59,11 +293,8 @@ FlightHandle Schedule_FindFlight(ScheduleHandle handle, const char* flightNumber
     try {
         auto* schedule = static_cast<Schedule*>(handle);
         auto flight = schedule->findFlight(std::string(flightNumber));
-        if (flight) {
-            // Создаём копию для возврата
-            return new Flight(*flight);
-        }
-        return nullptr;
+        // Дескриптор ссылается на рейс в расписании, а не на копию
+        return flight ? makeHandle(std::move(flight)) : nullptr;
     } catch (...) {
         return nullptr;
     }
@@ -79,22 +310,13 @@ int Schedule_IsValid(ScheduleHandle handle) {
     }
 }
 
-void Schedule_GetValidationErrors(ScheduleHandle handle, char* buffer, int bufferSize) {
-    if (!handle || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
-    }
+int Schedule_GetValidationErrors(ScheduleHandle handle, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
     try {
         auto* schedule = static_cast<Schedule*>(handle);
-        auto errors = schedule->getValidationErrors();
-        std::ostringstream oss;
-        for (const auto& error : errors) {
-            oss << error << "\n";
-        }
-        std::string result = oss.str();
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(validationErrorsText(*schedule), buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
     }
 }
 
@@ -108,62 +330,99 @@ void Schedule_ValidateAndFix(ScheduleHandle handle) {
     }
 }
 
-void Schedule_ToString(ScheduleHandle handle, char* buffer, int bufferSize) {
-    if (!handle || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
-    }
+int Schedule_ToString(ScheduleHandle handle, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
     try {
         auto* schedule = static_cast<Schedule*>(handle);
         std::string result = schedule->toString();
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
     }
 }
 
-void Schedule_GetScheduleForAircraft(ScheduleHandle handle, const char* aircraftId, char* buffer, int bufferSize) {
-    if (!handle || !aircraftId || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
-    }
+int Schedule_GetScheduleForAircraft(ScheduleHandle handle, const char* aircraftId, char* buffer, int bufferSize) {
+    if (!handle || !aircraftId) return copyString(std::string(), buffer, bufferSize);
     try {
         auto* schedule = static_cast<Schedule*>(handle);
         std::string result = schedule->getScheduleForAircraft(std::string(aircraftId));
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
     }
 }
 
-void Schedule_GetScheduleForAircraftInRange(ScheduleHandle handle, const char* aircraftId,
+int Schedule_GetScheduleForAircraftInRange(ScheduleHandle handle, const char* aircraftId,
                                             long long startTime, long long endTime, char* buffer, int bufferSize) {
-    if (!handle || !aircraftId || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
-    }
+    if (!handle || !aircraftId) return copyString(std::string(), buffer, bufferSize);
     try {
         auto* schedule = static_cast<Schedule*>(handle);
         std::string result = schedule->getScheduleForAircraftInRange(std::string(aircraftId),
                                                                       static_cast<std::time_t>(startTime),
                                                                       static_cast<std::time_t>(endTime));
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
     }
 }
 
-void Schedule_GetOverdueUrgentCargoReport(ScheduleHandle handle, char* buffer, int bufferSize) {
-    if (!handle || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
-    }
+int Schedule_GetOverdueUrgentCargoReport(ScheduleHandle handle, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
     try {
         auto* schedule = static_cast<Schedule*>(handle);
         std::string result = schedule->getOverdueUrgentCargoReport();
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
+    } catch (...) {
+        return copyString(std::string(), buffer, bufferSize);
+    }
+}
+
+char* Schedule_GetValidationErrorsAlloc(ScheduleHandle handle) {
+    if (!handle) return nullptr;
+    try {
+        return allocString(validationErrorsText(*static_cast<Schedule*>(handle)));
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+char* Schedule_ToStringAlloc(ScheduleHandle handle) {
+    if (!handle) return nullptr;
+    try {
+        return allocString(static_cast<Schedule*>(handle)->toString());
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+char* Schedule_GetScheduleForAircraftAlloc(ScheduleHandle handle, const char* aircraftId) {
+    if (!handle || !aircraftId) return nullptr;
+    try {
+        return allocString(static_cast<Schedule*>(handle)->getScheduleForAircraft(std::string(aircraftId)));
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+char* Schedule_GetScheduleForAircraftInRangeAlloc(ScheduleHandle handle, const char* aircraftId,
+                                                  long long startTime, long long endTime) {
+    if (!handle || !aircraftId) return nullptr;
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        return allocString(schedule->getScheduleForAircraftInRange(std::string(aircraftId),
+                                                                   static_cast<std::time_t>(startTime),
+                                                                   static_cast<std::time_t>(endTime)));
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+char* Schedule_GetOverdueUrgentCargoReportAlloc(ScheduleHandle handle) {
+    if (!handle) return nullptr;
+    try {
+        return allocString(static_cast<Schedule*>(handle)->getOverdueUrgentCargoReport());
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return nullptr;
     }
 }
 
@@ -187,6 +446,327 @@ int Schedule_GetTotalFlights(ScheduleHandle handle) {
     }
 }
 
+int Schedule_GetFlightNumberAt(ScheduleHandle handle, int index, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        const auto& flights = schedule->getFlights();
+        if (index < 0 || static_cast<size_t>(index) >= flights.size() || !flights[index]) {
+            return copyString(std::string(), buffer, bufferSize);
+        }
+        std::string result = flights[index]->getFlightNumber();
+        return copyString(result, buffer, bufferSize);
+    } catch (...) {
+        return copyString(std::string(), buffer, bufferSize);
+    }
+}
+
+int Schedule_ExportColumns(ScheduleHandle handle, FlightColumns* columns) {
+    if (!handle || !columns) return -1;
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        const auto& flights = schedule->getFlights();
+        columns->dictionary = nullptr;
+        columns->dictionaryCount = 0;
+        columns->dictionaryBytes = 0;
+        columns->maxFlightNumberLength = 0;
+        if (columns->capacity < 0 || static_cast<size_t>(columns->capacity) < flights.size()) {
+            return -1;
+        }
+
+        // Коды словаря присваиваются в порядке первого появления строки
+        std::unordered_map<std::string, int> codes;
+        std::vector<const std::string*> entries;
+        size_t dictionaryBytes = 0;
+        auto codeOf = [&](const std::string& text) {
+            auto it = codes.find(text);
+            if (it == codes.end()) {
+                it = codes.emplace(text, static_cast<int>(entries.size())).first;
+                entries.push_back(&it->first);
+                dictionaryBytes += text.size() + 1;
+            }
+            return it->second;
+        };
+
+        const std::time_t now = schedule->getClock()->now();
+        const size_t width = columns->flightNumberWidth > 0 ? static_cast<size_t>(columns->flightNumberWidth) : 0;
+        size_t maxNumberLength = 0;
+        for (size_t i = 0; i < flights.size(); ++i) {
+            const Flight& flight = *flights[i];
+            if (columns->departureTimes) columns->departureTimes[i] = static_cast<long long>(flight.getDepartureTime());
+            if (columns->arrivalTimes) columns->arrivalTimes[i] = static_cast<long long>(flight.getArrivalTime());
+            if (columns->aircraftCodes) columns->aircraftCodes[i] = codeOf(flight.getAircraftId());
+            if (columns->departureCodes) columns->departureCodes[i] = codeOf(flight.getDepartureAirport());
+            if (columns->destinationCodes) columns->destinationCodes[i] = codeOf(flight.getDestinationAirport());
+            if (columns->statuses) {
+                unsigned char status = FLIGHT_STATUS_ARRIVED;
+                if (flight.isCompleted()) {
+                    status = FLIGHT_STATUS_COMPLETED;
+                } else if (now < flight.getDepartureTime()) {
+                    status = FLIGHT_STATUS_SCHEDULED;
+                } else if (now <= flight.getArrivalTime()) {
+                    status = FLIGHT_STATUS_IN_PROGRESS;
+                }
+                columns->statuses[i] = status;
+            }
+            const std::string& number = flight.getFlightNumber();
+            maxNumberLength = std::max(maxNumberLength, number.size());
+            if (columns->flightNumbers && width > 0) {
+                char* field = columns->flightNumbers + i * width;
+                size_t length = std::min(number.size(), width);
+                std::memcpy(field, number.data(), length);
+                std::memset(field + length, 0, width - length);
+            }
+        }
+
+        char* dictionary = new char[dictionaryBytes + 1];
+        char* position = dictionary;
+        for (const std::string* entry : entries) {
+            std::memcpy(position, entry->data(), entry->size());
+            position += entry->size();
+            *position++ = '\0';
+        }
+        *position = '\0';
+        columns->dictionary = dictionary;
+        columns->dictionaryCount = static_cast<int>(entries.size());
+        columns->dictionaryBytes = static_cast<int>(dictionaryBytes);
+        columns->maxFlightNumberLength = static_cast<int>(maxNumberLength);
+        return static_cast<int>(flights.size());
+    } catch (...) {
+        return -1;
+    }
+}
+
+int Schedule_GetConflicts(ScheduleHandle handle, int* pairs, int maxPairs) {
+    return Schedule_GetConflictsWithTypes(handle, pairs, nullptr, maxPairs);
+}
+
+int Schedule_GetConflictsWithTypes(ScheduleHandle handle, int* pairs, int* types, int maxPairs) {
+    if (!handle) return 0;
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        auto conflicts = schedule->getConflicts();
+        if (maxPairs > 0) {
+            size_t count = std::min(conflicts.size(), static_cast<size_t>(maxPairs));
+            for (size_t i = 0; i < count; ++i) {
+                if (pairs) {
+                    pairs[2 * i] = static_cast<int>(conflicts[i].first);
+                    pairs[2 * i + 1] = static_cast<int>(conflicts[i].second);
+                }
+                if (types) {
+                    types[i] = static_cast<int>(conflicts[i].type);
+                }
+            }
+        }
+        return static_cast<int>(conflicts.size());
+    } catch (...) {
+        return 0;
+    }
+}
+
+void Schedule_SetMinGroundTime(ScheduleHandle handle, long long seconds) {
+    if (!handle) return;
+    try {
+        static_cast<Schedule*>(handle)->setMinGroundTime(static_cast<std::time_t>(seconds));
+    } catch (...) {
+        // Игнорируем ошибки
+    }
+}
+
+void Schedule_SetAircraftMinGroundTime(ScheduleHandle handle, const char* aircraftId, long long seconds) {
+    if (!handle || !aircraftId) return;
+    try {
+        static_cast<Schedule*>(handle)->setAircraftMinGroundTime(std::string(aircraftId), static_cast<std::time_t>(seconds));
+    } catch (...) {
+        // Игнорируем ошибки
+    }
+}
+
+void Schedule_SetAirportMinGroundTime(ScheduleHandle handle, const char* airportCode, long long seconds) {
+    if (!handle || !airportCode) return;
+    try {
+        static_cast<Schedule*>(handle)->setAirportMinGroundTime(std::string(airportCode), static_cast<std::time_t>(seconds));
+    } catch (...) {
+        // Игнорируем ошибки
+    }
+}
+
+void Schedule_SetChainCheckEnabled(ScheduleHandle handle, int enabled) {
+    if (!handle) return;
+    try {
+        static_cast<Schedule*>(handle)->setChainCheckEnabled(enabled != 0);
+    } catch (...) {
+        // Игнорируем ошибки
+    }
+}
+
+void Schedule_SetClockTime(ScheduleHandle handle, long long time) {
+    if (!handle) return;
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        schedule->setClock(std::make_shared<ManualClock>(static_cast<std::time_t>(time)));
+    } catch (...) {
+        // Игнорируем ошибки
+    }
+}
+
+void Schedule_UseSystemClock(ScheduleHandle handle) {
+    if (!handle) return;
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        schedule->setClock(nullptr);
+    } catch (...) {
+        // Игнорируем ошибки
+    }
+}
+
+void Schedule_RegisterAircraft(ScheduleHandle handle, AircraftHandle aircraft) {
+    if (!handle || !aircraft) return;
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        sharedOf<Aircraft>(aircraft)->setDeadlineIndex(schedule->getCargoDeadlineIndex());
+    } catch (...) {
+        // Игнорируем ошибки
+    }
+}
+
+void Schedule_RegisterAirport(ScheduleHandle handle, AirportHandle airport) {
+    if (!handle || !airport) return;
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        sharedOf<Airport>(airport)->setDeadlineIndex(schedule->getCargoDeadlineIndex());
+    } catch (...) {
+        // Игнорируем ошибки
+    }
+}
+
+int Schedule_AdvanceClock(ScheduleHandle handle, long long time) {
+    if (!handle) return 0;
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        std::time_t now = static_cast<std::time_t>(time);
+        // Ручные часы переводятся на time; системные и прочие часы не подменяются
+        if (auto manual = std::dynamic_pointer_cast<const ManualClock>(schedule->getClock())) {
+            std::const_pointer_cast<ManualClock>(manual)->setTime(now);
+        }
+        EventEngine& engine = schedule->getEventEngine(now);
+        engine.setQueueEnabled(true);
+        return static_cast<int>(schedule->processEvents(now));
+    } catch (...) {
+        return 0;
+    }
+}
+
+int Schedule_PollEvents(ScheduleHandle handle, ScheduleEventRecord* events, int maxEvents) {
+    if (!handle || !events || maxEvents <= 0) return 0;
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        auto polled = schedule->getEventEngine().poll(static_cast<size_t>(maxEvents));
+        for (size_t i = 0; i < polled.size(); ++i) {
+            events[i].type = static_cast<int>(polled[i].type);
+            events[i].time = static_cast<long long>(polled[i].time);
+            strncpy_s(events[i].subject, sizeof(events[i].subject), polled[i].subject.c_str(), _TRUNCATE);
+            strncpy_s(events[i].location, sizeof(events[i].location), polled[i].location.c_str(), _TRUNCATE);
+        }
+        return static_cast<int>(polled.size());
+    } catch (...) {
+        return 0;
+    }
+}
+
+long long Schedule_GetVersion(ScheduleHandle handle) {
+    if (!handle) return 0;
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        return static_cast<long long>(schedule->getVersion());
+    } catch (...) {
+        return 0;
+    }
+}
+
+int Schedule_GetChangesSince(ScheduleHandle handle, long long version, ScheduleChangeRecord* changes, int maxChanges) {
+    if (!handle || !changes || maxChanges <= 0 || version < 0) return CHANGES_INVALID_ARGUMENT;
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        std::vector<ScheduleChange> journal;
+        if (!schedule->getChangesSince(static_cast<std::uint64_t>(version), journal, static_cast<size_t>(maxChanges))) {
+            return CHANGES_RESYNC_REQUIRED;
+        }
+        for (size_t i = 0; i < journal.size(); ++i) {
+            const ScheduleChange& change = journal[i];
+            changes[i].version = static_cast<long long>(change.version);
+            changes[i].type = static_cast<int>(change.type);
+            strncpy_s(changes[i].flightNumber, sizeof(changes[i].flightNumber), change.flightNumber.c_str(), _TRUNCATE);
+            strncpy_s(changes[i].departureAirport, sizeof(changes[i].departureAirport), change.departureAirport.c_str(), _TRUNCATE);
+            strncpy_s(changes[i].destinationAirport, sizeof(changes[i].destinationAirport), change.destinationAirport.c_str(), _TRUNCATE);
+            strncpy_s(changes[i].aircraftId, sizeof(changes[i].aircraftId), change.aircraftId.c_str(), _TRUNCATE);
+            changes[i].departureTime = static_cast<long long>(change.departureTime);
+            changes[i].arrivalTime = static_cast<long long>(change.arrivalTime);
+            changes[i].completed = change.completed ? 1 : 0;
+        }
+        return static_cast<int>(journal.size());
+    } catch (...) {
+        return CHANGES_INVALID_ARGUMENT;
+    }
+}
+
+// ============================================
+// Cursor API Implementation
+// ============================================
+
+CursorHandle Schedule_OpenCursor(ScheduleHandle handle, const char* aircraftId, const char* airportCode,
+                                 long long startTime, long long endTime) {
+    if (!handle) return nullptr;
+    try {
+        auto* schedule = static_cast<Schedule*>(handle);
+        FlightCursorFilter filter;
+        if (aircraftId) filter.aircraftId = aircraftId;
+        if (airportCode) filter.airportCode = airportCode;
+        if (startTime != 0) filter.startTime = static_cast<std::time_t>(startTime);
+        if (endTime != 0) filter.endTime = static_cast<std::time_t>(endTime);
+        return new FlightCursor(*schedule, filter);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+int Cursor_Next(CursorHandle cursor, FlightRecord* records, int maxRecords) {
+    if (!cursor || !records || maxRecords <= 0) return 0;
+    try {
+        auto* flightCursor = static_cast<FlightCursor*>(cursor);
+        std::vector<std::shared_ptr<Flight>> batch;
+        flightCursor->next(batch, static_cast<size_t>(maxRecords));
+        for (size_t i = 0; i < batch.size(); ++i) {
+            const Flight& flight = *batch[i];
+            strncpy_s(records[i].flightNumber, sizeof(records[i].flightNumber), flight.getFlightNumber().c_str(), _TRUNCATE);
+            strncpy_s(records[i].departureAirport, sizeof(records[i].departureAirport), flight.getDepartureAirport().c_str(), _TRUNCATE);
+            strncpy_s(records[i].destinationAirport, sizeof(records[i].destinationAirport), flight.getDestinationAirport().c_str(), _TRUNCATE);
+            strncpy_s(records[i].aircraftId, sizeof(records[i].aircraftId), flight.getAircraftId().c_str(), _TRUNCATE);
+            records[i].departureTime = static_cast<long long>(flight.getDepartureTime());
+            records[i].arrivalTime = static_cast<long long>(flight.getArrivalTime());
+            records[i].completed = flight.isCompleted() ? 1 : 0;
+        }
+        return static_cast<int>(batch.size());
+    } catch (...) {
+        return 0;
+    }
+}
+
+long long Cursor_GetVersion(CursorHandle cursor) {
+    if (!cursor) return 0;
+    try {
+        return static_cast<long long>(static_cast<FlightCursor*>(cursor)->getReadVersion());
+    } catch (...) {
+        return 0;
+    }
+}
+
+void Cursor_Close(CursorHandle cursor) {
+    if (cursor) {
+        delete static_cast<FlightCursor*>(cursor);
+    }
+}
+
 // ============================================
 // Flight API Implementation
 // ============================================
@@ -195,9 +775,9 @@ FlightHandle Flight_Create(const char* number, const char* departure, const char
                            long long depTime, long long arrTime, const char* aircraft) {
     if (!number || !departure || !destination || !aircraft) return nullptr;
     try {
-        return new Flight(std::string(number), std::string(departure), std::string(destination),
-                         static_cast<std::time_t>(depTime), static_cast<std::time_t>(arrTime),
-                         std::string(aircraft));
+        return makeHandle(std::make_shared<Flight>(std::string(number), std::string(departure), std::string(destination),
+                                                  static_cast<std::time_t>(depTime), static_cast<std::time_t>(arrTime),
+                                                  std::string(aircraft)));
     } catch (...) {
         return nullptr;
     }
@@ -205,56 +785,47 @@ FlightHandle Flight_Create(const char* number, const char* departure, const char
 
 void Flight_Destroy(FlightHandle handle) {
     if (handle) {
-        delete static_cast<Flight*>(handle);
+        releaseHandle<Flight>(handle);
     }
 }
 
-void Flight_GetFlightNumber(FlightHandle handle, char* buffer, int bufferSize) {
-    if (!handle || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
-    }
+int Flight_GetFlightNumber(FlightHandle handle, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
     try {
-        auto* flight = static_cast<Flight*>(handle);
+        auto* flight = sharedOf<Flight>(handle).get();
         std::string result = flight->getFlightNumber();
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
     }
 }
 
-void Flight_GetDepartureAirport(FlightHandle handle, char* buffer, int bufferSize) {
-    if (!handle || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
-    }
+int Flight_GetDepartureAirport(FlightHandle handle, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
     try {
-        auto* flight = static_cast<Flight*>(handle);
+        auto* flight = sharedOf<Flight>(handle).get();
         std::string result = flight->getDepartureAirport();
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
     }
 }
 
-void Flight_GetDestinationAirport(FlightHandle handle, char* buffer, int bufferSize) {
-    if (!handle || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
-    }
+int Flight_GetDestinationAirport(FlightHandle handle, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
     try {
-        auto* flight = static_cast<Flight*>(handle);
+        auto* flight = sharedOf<Flight>(handle).get();
         std::string result = flight->getDestinationAirport();
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
     }
 }
 
 long long Flight_GetDepartureTime(FlightHandle handle) {
     if (!handle) return 0;
     try {
-        auto* flight = static_cast<Flight*>(handle);
+        auto* flight = sharedOf<Flight>(handle).get();
         return static_cast<long long>(flight->getDepartureTime());
     } catch (...) {
         return 0;
@@ -264,55 +835,49 @@ long long Flight_GetDepartureTime(FlightHandle handle) {
 long long Flight_GetArrivalTime(FlightHandle handle) {
     if (!handle) return 0;
     try {
-        auto* flight = static_cast<Flight*>(handle);
+        auto* flight = sharedOf<Flight>(handle).get();
         return static_cast<long long>(flight->getArrivalTime());
     } catch (...) {
         return 0;
     }
 }
 
-void Flight_GetAircraftId(FlightHandle handle, char* buffer, int bufferSize) {
-    if (!handle || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
-    }
+int Flight_GetAircraftId(FlightHandle handle, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
     try {
-        auto* flight = static_cast<Flight*>(handle);
+        auto* flight = sharedOf<Flight>(handle).get();
         std::string result = flight->getAircraftId();
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
     }
 }
 
 int Flight_IsCompleted(FlightHandle handle) {
     if (!handle) return 0;
     try {
-        auto* flight = static_cast<Flight*>(handle);
+        auto* flight = sharedOf<Flight>(handle).get();
         return flight->isCompleted() ? 1 : 0;
     } catch (...) {
         return 0;
     }
 }
 
-void Flight_ToString(FlightHandle handle, char* buffer, int bufferSize) {
-    if (!handle || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
-    }
+int Flight_ToString(FlightHandle handle, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
     try {
-        auto* flight = static_cast<Flight*>(handle);
+        auto* flight = sharedOf<Flight>(handle).get();
         std::string result = flight->toString();
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
     }
 }
 
 int Flight_IsValid(FlightHandle handle) {
     if (!handle) return 0;
     try {
-        auto* flight = static_cast<Flight*>(handle);
+        auto* flight = sharedOf<Flight>(handle).get();
         return flight->isValid() ? 1 : 0;
     } catch (...) {
         return 0;
@@ -322,7 +887,7 @@ int Flight_IsValid(FlightHandle handle) {
 double Flight_GetFlightDurationHours(FlightHandle handle) {
     if (!handle) return 0.0;
     try {
-        auto* flight = static_cast<Flight*>(handle);
+        auto* flight = sharedOf<Flight>(handle).get();
         return flight->getFlightDurationHours();
     } catch (...) {
         return 0.0;
@@ -336,7 +901,7 @@ double Flight_GetFlightDurationHours(FlightHandle handle) {
 AircraftHandle Aircraft_Create(const char* number, double maxPayload) {
     if (!number) return nullptr;
     try {
-        return new Aircraft(std::string(number), maxPayload);
+        return makeHandle(std::make_shared<Aircraft>(std::string(number), maxPayload));
     } catch (const InvalidAircraftException& e) {
         // Ловим конкретное исключение для некорректной грузоподъёмности
         // В реальном приложении здесь можно было бы логировать ошибку
@@ -352,28 +917,25 @@ AircraftHandle Aircraft_Create(const char* number, double maxPayload) {
 
 void Aircraft_Destroy(AircraftHandle handle) {
     if (handle) {
-        delete static_cast<Aircraft*>(handle);
+        releaseHandle<Aircraft>(handle);
     }
 }
 
-void Aircraft_GetAircraftNumber(AircraftHandle handle, char* buffer, int bufferSize) {
-    if (!handle || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
-    }
+int Aircraft_GetAircraftNumber(AircraftHandle handle, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
     try {
-        auto* aircraft = static_cast<Aircraft*>(handle);
+        auto* aircraft = sharedOf<Aircraft>(handle).get();
         std::string result = aircraft->getAircraftNumber();
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
     }
 }
 
 double Aircraft_GetMaxPayload(AircraftHandle handle) {
     if (!handle) return 0.0;
     try {
-        auto* aircraft = static_cast<Aircraft*>(handle);
+        auto* aircraft = sharedOf<Aircraft>(handle).get();
         return aircraft->getMaxPayload();
     } catch (...) {
         return 0.0;
@@ -383,7 +945,7 @@ double Aircraft_GetMaxPayload(AircraftHandle handle) {
 double Aircraft_GetCurrentPayload(AircraftHandle handle) {
     if (!handle) return 0.0;
     try {
-        auto* aircraft = static_cast<Aircraft*>(handle);
+        auto* aircraft = sharedOf<Aircraft>(handle).get();
         return aircraft->getCurrentPayload();
     } catch (...) {
         return 0.0;
@@ -393,9 +955,8 @@ double Aircraft_GetCurrentPayload(AircraftHandle handle) {
 int Aircraft_AddCargo(AircraftHandle handle, CargoHandle cargo) {
     if (!handle || !cargo) return 0;
     try {
-        auto* aircraft = static_cast<Aircraft*>(handle);
-        auto* cargoPtr = static_cast<Cargo*>(cargo);
-        auto sharedCargo = std::make_shared<Cargo>(*cargoPtr);
+        auto* aircraft = sharedOf<Aircraft>(handle).get();
+        const auto& sharedCargo = sharedOf<Cargo>(cargo);
         return aircraft->addCargo(sharedCargo) ? 1 : 0;
     } catch (...) {
         return 0;
@@ -405,9 +966,8 @@ int Aircraft_AddCargo(AircraftHandle handle, CargoHandle cargo) {
 int Aircraft_AddUrgentCargo(AircraftHandle handle, UrgentCargoHandle urgentCargo) {
     if (!handle || !urgentCargo) return 0;
     try {
-        auto* aircraft = static_cast<Aircraft*>(handle);
-        auto* urgentCargoPtr = static_cast<UrgentCargo*>(urgentCargo);
-        auto sharedUrgentCargo = std::make_shared<UrgentCargo>(*urgentCargoPtr);
+        auto* aircraft = sharedOf<Aircraft>(handle).get();
+        const auto& sharedUrgentCargo = sharedOf<UrgentCargo>(urgentCargo);
         return aircraft->addUrgentCargo(sharedUrgentCargo) ? 1 : 0;
     } catch (...) {
         return 0;
@@ -417,33 +977,80 @@ int Aircraft_AddUrgentCargo(AircraftHandle handle, UrgentCargoHandle urgentCargo
 int Aircraft_AddPassenger(AircraftHandle handle, PassengerHandle passenger) {
     if (!handle || !passenger) return 0;
     try {
-        auto* aircraft = static_cast<Aircraft*>(handle);
-        auto* passengerPtr = static_cast<Passenger*>(passenger);
-        auto sharedPassenger = std::make_shared<Passenger>(*passengerPtr);
+        auto* aircraft = sharedOf<Aircraft>(handle).get();
+        const auto& sharedPassenger = sharedOf<Passenger>(passenger);
         return aircraft->addPassenger(sharedPassenger) ? 1 : 0;
     } catch (...) {
         return 0;
     }
 }
 
-void Aircraft_ToString(AircraftHandle handle, char* buffer, int bufferSize) {
-    if (!handle || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
+int Aircraft_AddCargoBatch(AircraftHandle handle, const CargoRow* rows, int rowCount,
+                           const char* strings, int stringsSize, int* statuses) {
+    if (!handle || !rows || rowCount <= 0) return 0;
+    int i = 0;
+    try {
+        auto* aircraft = sharedOf<Aircraft>(handle).get();
+        std::time_t now = std::time(nullptr);  // Один снимок часов на пакет
+        int added = 0;
+        for (; i < rowCount; ++i) {
+            const CargoRow& row = rows[i];
+            const char* number = batchString(strings, stringsSize, row.cargoNumber);
+            const char* departure = batchString(strings, stringsSize, row.departureAirport);
+            const char* destination = batchString(strings, stringsSize, row.destinationAirport);
+            const char* current = batchString(strings, stringsSize, row.currentLocation);
+            int status = BATCH_ROW_INVALID;
+            if (number && departure && destination && current) {
+                std::shared_ptr<Cargo> cargo;
+                if (row.deadline != 0) {
+                    auto urgent = std::make_shared<UrgentCargo>(number, row.mass, departure, destination, current,
+                        static_cast<std::time_t>(row.arrivalTime), static_cast<std::time_t>(row.deadline));
+                    cargo = urgent;
+                    if (urgent->isValid(now)) {
+                        status = aircraft->addUrgentCargo(urgent, now) ? BATCH_ROW_OK : BATCH_ROW_NO_CAPACITY;
+                    }
+                } else {
+                    cargo = std::make_shared<Cargo>(number, row.mass, departure, destination, current,
+                        static_cast<std::time_t>(row.arrivalTime));
+                    if (cargo->isValid()) {
+                        status = aircraft->addCargo(cargo) ? BATCH_ROW_OK : BATCH_ROW_NO_CAPACITY;
+                    }
+                }
+            }
+            added += status == BATCH_ROW_OK;
+            if (statuses) statuses[i] = status;
+        }
+        return added;
+    } catch (...) {
+        failBatchRows(statuses, i, rowCount);
+        return 0;
     }
+}
+
+int Aircraft_ToString(AircraftHandle handle, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
     try {
-        auto* aircraft = static_cast<Aircraft*>(handle);
+        auto* aircraft = sharedOf<Aircraft>(handle).get();
         std::string result = aircraft->toString();
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
+    }
+}
+
+char* Aircraft_ToStringAlloc(AircraftHandle handle) {
+    if (!handle) return nullptr;
+    try {
+        return allocString(sharedOf<Aircraft>(handle)->toString());
+    } catch (...) {
+        return nullptr;
     }
 }
 
 double Aircraft_GetAvailableCapacity(AircraftHandle handle) {
     if (!handle) return 0.0;
     try {
-        auto* aircraft = static_cast<Aircraft*>(handle);
+        auto* aircraft = sharedOf<Aircraft>(handle).get();
         return aircraft->getAvailableCapacity();
     } catch (...) {
         return 0.0;
@@ -457,7 +1064,7 @@ double Aircraft_GetAvailableCapacity(AircraftHandle handle) {
 AirportHandle Airport_Create(const char* name) {
     if (!name) return nullptr;
     try {
-        return new Airport(std::string(name));
+        return makeHandle(std::make_shared<Airport>(std::string(name)));
     } catch (...) {
         return nullptr;
     }
@@ -465,30 +1072,26 @@ AirportHandle Airport_Create(const char* name) {
 
 void Airport_Destroy(AirportHandle handle) {
     if (handle) {
-        delete static_cast<Airport*>(handle);
+        releaseHandle<Airport>(handle);
     }
 }
 
-void Airport_GetName(AirportHandle handle, char* buffer, int bufferSize) {
-    if (!handle || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
-    }
+int Airport_GetName(AirportHandle handle, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
     try {
-        auto* airport = static_cast<Airport*>(handle);
+        auto* airport = sharedOf<Airport>(handle).get();
         std::string result = airport->getName();
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
     }
 }
 
 void Airport_AddAircraft(AirportHandle handle, AircraftHandle aircraft) {
     if (!handle || !aircraft) return;
     try {
-        auto* airport = static_cast<Airport*>(handle);
-        auto* aircraftPtr = static_cast<Aircraft*>(aircraft);
-        auto sharedAircraft = std::make_shared<Aircraft>(*aircraftPtr);
+        auto* airport = sharedOf<Airport>(handle).get();
+        const auto& sharedAircraft = sharedOf<Aircraft>(aircraft);
         airport->addAircraft(sharedAircraft);
     } catch (...) {
         // Игнорируем ошибки
@@ -498,26 +1101,61 @@ void Airport_AddAircraft(AirportHandle handle, AircraftHandle aircraft) {
 void Airport_AddCargo(AirportHandle handle, CargoHandle cargo) {
     if (!handle || !cargo) return;
     try {
-        auto* airport = static_cast<Airport*>(handle);
-        auto* cargoPtr = static_cast<Cargo*>(cargo);
-        auto sharedCargo = std::make_shared<Cargo>(*cargoPtr);
+        auto* airport = sharedOf<Airport>(handle).get();
+        const auto& sharedCargo = sharedOf<Cargo>(cargo);
         airport->addCargo(sharedCargo);
     } catch (...) {
         // Игнорируем ошибки
     }
 }
 
-void Airport_ToString(AirportHandle handle, char* buffer, int bufferSize) {
-    if (!handle || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
+int Airport_AddPassengersBatch(AirportHandle handle, const PassengerRow* rows, int rowCount,
+                               const char* strings, int stringsSize, int* statuses) {
+    if (!handle || !rows || rowCount <= 0) return 0;
+    int i = 0;
+    try {
+        auto* airport = sharedOf<Airport>(handle).get();
+        int added = 0;
+        for (; i < rowCount; ++i) {
+            const char* number = batchString(strings, stringsSize, rows[i].passengerNumber);
+            const char* name = batchString(strings, stringsSize, rows[i].name);
+            const char* departure = batchString(strings, stringsSize, rows[i].departureAirport);
+            const char* destination = batchString(strings, stringsSize, rows[i].destinationAirport);
+            int status = BATCH_ROW_INVALID;
+            if (number && name && departure && destination) {
+                auto passenger = std::make_shared<Passenger>(number, name, departure, destination);
+                if (passenger->isValid()) {
+                    airport->addPassenger(passenger);
+                    status = BATCH_ROW_OK;
+                }
+            }
+            added += status == BATCH_ROW_OK;
+            if (statuses) statuses[i] = status;
+        }
+        return added;
+    } catch (...) {
+        failBatchRows(statuses, i, rowCount);
+        return 0;
     }
+}
+
+int Airport_ToString(AirportHandle handle, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
     try {
-        auto* airport = static_cast<Airport*>(handle);
+        auto* airport = sharedOf<Airport>(handle).get();
         std::string result = airport->toString();
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
+    }
+}
+
+char* Airport_ToStringAlloc(AirportHandle handle) {
+    if (!handle) return nullptr;
+    try {
+        return allocString(sharedOf<Airport>(handle)->toString());
+    } catch (...) {
+        return nullptr;
     }
 }
 
@@ -529,9 +1167,9 @@ CargoHandle Cargo_Create(const char* number, double mass, const char* departure,
                          const char* destination, const char* current, long long arrival) {
     if (!number || !departure || !destination || !current) return nullptr;
     try {
-        return new Cargo(std::string(number), mass, std::string(departure),
-                        std::string(destination), std::string(current),
-                        static_cast<std::time_t>(arrival));
+        return makeHandle(std::make_shared<Cargo>(std::string(number), mass, std::string(departure),
+                                                 std::string(destination), std::string(current),
+                                                 static_cast<std::time_t>(arrival)));
     } catch (...) {
         return nullptr;
     }
@@ -539,45 +1177,39 @@ CargoHandle Cargo_Create(const char* number, double mass, const char* departure,
 
 void Cargo_Destroy(CargoHandle handle) {
     if (handle) {
-        delete static_cast<Cargo*>(handle);
+        releaseHandle<Cargo>(handle);
     }
 }
 
-void Cargo_GetCargoNumber(CargoHandle handle, char* buffer, int bufferSize) {
-    if (!handle || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
-    }
+int Cargo_GetCargoNumber(CargoHandle handle, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
     try {
-        auto* cargo = static_cast<Cargo*>(handle);
+        auto* cargo = sharedOf<Cargo>(handle).get();
         std::string result = cargo->getCargoNumber();
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
     }
 }
 
 double Cargo_GetMass(CargoHandle handle) {
     if (!handle) return 0.0;
     try {
-        auto* cargo = static_cast<Cargo*>(handle);
+        auto* cargo = sharedOf<Cargo>(handle).get();
         return cargo->getMass();
     } catch (...) {
         return 0.0;
     }
 }
 
-void Cargo_ToString(CargoHandle handle, char* buffer, int bufferSize) {
-    if (!handle || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
-    }
+int Cargo_ToString(CargoHandle handle, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
     try {
-        auto* cargo = static_cast<Cargo*>(handle);
+        auto* cargo = sharedOf<Cargo>(handle).get();
         std::string result = cargo->toString();
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
     }
 }
 
@@ -590,10 +1222,10 @@ UrgentCargoHandle UrgentCargo_Create(const char* number, double mass, const char
                                       long long arrival, long long deadline) {
     if (!number || !departure || !destination || !current) return nullptr;
     try {
-        return new UrgentCargo(std::string(number), mass, std::string(departure),
-                              std::string(destination), std::string(current),
-                              static_cast<std::time_t>(arrival),
-                              static_cast<std::time_t>(deadline));
+        return makeHandle(std::make_shared<UrgentCargo>(std::string(number), mass, std::string(departure),
+                                                       std::string(destination), std::string(current),
+                                                       static_cast<std::time_t>(arrival),
+                                                       static_cast<std::time_t>(deadline)));
     } catch (...) {
         return nullptr;
     }
@@ -601,31 +1233,28 @@ UrgentCargoHandle UrgentCargo_Create(const char* number, double mass, const char
 
 void UrgentCargo_Destroy(UrgentCargoHandle handle) {
     if (handle) {
-        delete static_cast<UrgentCargo*>(handle);
+        releaseHandle<UrgentCargo>(handle);
     }
 }
 
 int UrgentCargo_IsOverdue(UrgentCargoHandle handle) {
     if (!handle) return 0;
     try {
-        auto* urgentCargo = static_cast<UrgentCargo*>(handle);
+        auto* urgentCargo = sharedOf<UrgentCargo>(handle).get();
         return urgentCargo->isOverdue() ? 1 : 0;
     } catch (...) {
         return 0;
     }
 }
 
-void UrgentCargo_ToString(UrgentCargoHandle handle, char* buffer, int bufferSize) {
-    if (!handle || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
-    }
+int UrgentCargo_ToString(UrgentCargoHandle handle, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
     try {
-        auto* urgentCargo = static_cast<UrgentCargo*>(handle);
+        auto* urgentCargo = sharedOf<UrgentCargo>(handle).get();
         std::string result = urgentCargo->toString();
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
     }
 }
 
@@ -637,8 +1266,8 @@ PassengerHandle Passenger_Create(const char* number, const char* name,
                                   const char* departure, const char* destination) {
     if (!number || !name || !departure || !destination) return nullptr;
     try {
-        return new Passenger(std::string(number), std::string(name),
-                            std::string(departure), std::string(destination));
+        return makeHandle(std::make_shared<Passenger>(std::string(number), std::string(name),
+                                                     std::string(departure), std::string(destination)));
     } catch (...) {
         return nullptr;
     }
@@ -646,49 +1275,40 @@ PassengerHandle Passenger_Create(const char* number, const char* name,
 
 void Passenger_Destroy(PassengerHandle handle) {
     if (handle) {
-        delete static_cast<Passenger*>(handle);
+        releaseHandle<Passenger>(handle);
     }
 }
 
-void Passenger_GetPassengerNumber(PassengerHandle handle, char* buffer, int bufferSize) {
-    if (!handle || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
-    }
+int Passenger_GetPassengerNumber(PassengerHandle handle, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
     try {
-        auto* passenger = static_cast<Passenger*>(handle);
+        auto* passenger = sharedOf<Passenger>(handle).get();
         std::string result = passenger->getPassengerNumber();
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
     }
 }
 
-void Passenger_GetName(PassengerHandle handle, char* buffer, int bufferSize) {
-    if (!handle || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
-    }
+int Passenger_GetName(PassengerHandle handle, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
     try {
-        auto* passenger = static_cast<Passenger*>(handle);
+        auto* passenger = sharedOf<Passenger>(handle).get();
         std::string result = passenger->getName();
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
     }
 }
 
-void Passenger_ToString(PassengerHandle handle, char* buffer, int bufferSize) {
-    if (!handle || !buffer || bufferSize <= 0) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
-        return;
-    }
+int Passenger_ToString(PassengerHandle handle, char* buffer, int bufferSize) {
+    if (!handle) return copyString(std::string(), buffer, bufferSize);
     try {
-        auto* passenger = static_cast<Passenger*>(handle);
+        auto* passenger = sharedOf<Passenger>(handle).get();
         std::string result = passenger->toString();
-        strncpy_s(buffer, bufferSize, result.c_str(), _TRUNCATE);
+        return copyString(result, buffer, bufferSize);
     } catch (...) {
-        if (buffer && bufferSize > 0) buffer[0] = '\0';
+        return copyString(std::string(), buffer, bufferSize);
     }
 }
 
@@ -0,0 +1,129 @@
+#include "FlightStatusTracker.h"
+#include <vector>
+
+// Создать пустой трекер
+FlightStatusTracker::FlightStatusTracker(std::time_t now) : now(now), completedCount(0) {
+}
+
+// Убрать рейс из раздела: поиск среди рейсов с тем же ключом
+bool FlightStatusTracker::eraseFrom(std::multimap<std::time_t, const Flight*>& partition,
+                                    std::time_t key, const Flight* flight) {
+    auto range = partition.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == flight) {
+            partition.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Поместить рейс в раздел, соответствующий текущему моменту
+void FlightStatusTracker::place(const Flight* flight) {
+    if (flight->isCompleted()) {
+        ++completedCount;
+    } else if (now < flight->getDepartureTime()) {
+        scheduled.emplace(flight->getDepartureTime(), flight);
+    } else if (now <= flight->getArrivalTime()) {
+        inProgress.emplace(flight->getArrivalTime(), flight);
+    } else {
+        arrived.emplace(flight->getArrivalTime(), flight);
+    }
+}
+
+// Учесть рейс
+void FlightStatusTracker::add(const Flight* flight) {
+    if (flight) {
+        place(flight);
+    }
+}
+
+// Перестать учитывать рейс: раздел определяется так же, как при добавлении
+void FlightStatusTracker::remove(const Flight* flight) {
+    if (!flight) {
+        return;
+    }
+    if (flight->isCompleted()) {
+        if (completedCount > 0) {
+            --completedCount;
+        }
+    } else if (now < flight->getDepartureTime()) {
+        eraseFrom(scheduled, flight->getDepartureTime(), flight);
+    } else if (now <= flight->getArrivalTime()) {
+        eraseFrom(inProgress, flight->getArrivalTime(), flight);
+    } else {
+        eraseFrom(arrived, flight->getArrivalTime(), flight);
+    }
+}
+
+// Убрать все рейсы
+void FlightStatusTracker::clear() {
+    scheduled.clear();
+    inProgress.clear();
+    arrived.clear();
+    completedCount = 0;
+}
+
+// Перевести часы
+// Вперёд: вылетевшие рейсы снимаются с начала раздела запланированных,
+// прибывшие — с начала раздела рейсов в полёте. Назад: разделы перестраиваются.
+void FlightStatusTracker::advanceTo(std::time_t time) {
+    if (time == now) {
+        return;
+    }
+    if (time < now) {
+        std::vector<const Flight*> pending;
+        pending.reserve(scheduled.size() + inProgress.size() + arrived.size());
+        for (const auto& entry : scheduled) pending.push_back(entry.second);
+        for (const auto& entry : inProgress) pending.push_back(entry.second);
+        for (const auto& entry : arrived) pending.push_back(entry.second);
+        scheduled.clear();
+        inProgress.clear();
+        arrived.clear();
+        now = time;
+        for (const Flight* flight : pending) {
+            place(flight);
+        }
+        return;
+    }
+    
+    now = time;
+    while (!scheduled.empty() && scheduled.begin()->first <= now) {
+        const Flight* flight = scheduled.begin()->second;
+        scheduled.erase(scheduled.begin());
+        if (now <= flight->getArrivalTime()) {
+            inProgress.emplace(flight->getArrivalTime(), flight);
+        } else {
+            arrived.emplace_hint(arrived.end(), flight->getArrivalTime(), flight);
+        }
+    }
+    while (!inProgress.empty() && inProgress.begin()->first < now) {
+        arrived.emplace_hint(arrived.end(), inProgress.begin()->first, inProgress.begin()->second);
+        inProgress.erase(inProgress.begin());
+    }
+}
+
+// Текущий момент часов
+std::time_t FlightStatusTracker::getTime() const {
+    return now;
+}
+
+// Число запланированных рейсов
+int FlightStatusTracker::getScheduledCount() const {
+    return static_cast<int>(scheduled.size());
+}
+
+// Число рейсов в полёте
+int FlightStatusTracker::getInProgressCount() const {
+    return static_cast<int>(inProgress.size());
+}
+
+// Число прибывших, но не завершённых рейсов
+int FlightStatusTracker::getArrivedCount() const {
+    return static_cast<int>(arrived.size());
+}
+
+// Число завершённых рейсов
+int FlightStatusTracker::getCompletedCount() const {
+    return static_cast<int>(completedCount);
+}
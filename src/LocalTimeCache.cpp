@@ -0,0 +1,174 @@
+#include "LocalTimeCache.h"
+#include <algorithm>
+#include <utility>
+
+// Целочисленное деление с округлением вниз (для моментов до 1970 года)
+static long long floorDiv(long long value, long long divisor) {
+    long long quotient = value / divisor;
+    if ((value % divisor != 0) && ((value < 0) != (divisor < 0))) {
+        --quotient;
+    }
+    return quotient;
+}
+
+// Число суток от 1970-01-01 до даты григорианского календаря
+static long long daysFromCivil(long long year, unsigned month, unsigned day) {
+    year -= month <= 2 ? 1 : 0;
+    long long era = floorDiv(year, 400);
+    unsigned yearOfEra = static_cast<unsigned>(year - era * 400);
+    unsigned dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + static_cast<long long>(dayOfEra) - 719468;
+}
+
+// Смещение местного времени от UTC: местные дата и время, прочитанные как UTC, минус сам момент
+long LocalTimeCache::computeOffset(std::time_t time) {
+    std::tm tm;
+    localtime_s(&tm, &time);
+    long long localSeconds = daysFromCivil(tm.tm_year + 1900LL, static_cast<unsigned>(tm.tm_mon + 1),
+                                           static_cast<unsigned>(tm.tm_mday)) * DAY_SECONDS +
+                             tm.tm_hour * 3600LL + tm.tm_min * 60LL + tm.tm_sec;
+    return static_cast<long>(localSeconds - static_cast<long long>(time));
+}
+
+// Местная полночь после time без кэша
+// Полночь переводится в UTC и со смещением на момент time, и со смещением на
+// саму полночь: между ними может произойти переход на летнее/зимнее время.
+// Берётся более ранний из кандидатов, уже принадлежащий следующим суткам
+// (если переход приходится на полночь, сутки начинаются с момента перехода).
+std::time_t LocalTimeCache::computeNextLocalMidnight(std::time_t time) {
+    long long nextDay = floorDiv(static_cast<long long>(time) + computeOffset(time), DAY_SECONDS) + 1;
+    long long localMidnight = nextDay * DAY_SECONDS;
+    std::time_t first = static_cast<std::time_t>(localMidnight - computeOffset(time));
+    std::time_t second = static_cast<std::time_t>(localMidnight - computeOffset(first));
+    if (second < first) {
+        std::swap(first, second);
+    }
+    if (first > time && floorDiv(static_cast<long long>(first) + computeOffset(first), DAY_SECONDS) >= nextDay) {
+        return first;
+    }
+    return second > time ? second : time + 1;
+}
+
+// Сведения о сутках UTC: смещения, момент их смены (двоичным поиском) и местная полночь
+LocalTimeCache::DayOffsets LocalTimeCache::computeDay(long long utcDay) {
+    std::time_t dayStart = static_cast<std::time_t>(utcDay * DAY_SECONDS);
+    std::time_t nextDayStart = dayStart + DAY_SECONDS;
+    long offsetAtStart = computeOffset(dayStart);
+    long offsetAtEnd = computeOffset(nextDayStart);
+    
+    DayOffsets offsets;
+    offsets.offsetAtStart = offsetAtStart;
+    offsets.transition = nextDayStart;
+    offsets.offsetAfter = offsetAtStart;
+    if (offsetAtEnd != offsetAtStart) {
+        // Смена смещения внутри суток: ищем первый момент с новым смещением
+        std::time_t low = dayStart;
+        std::time_t high = nextDayStart;
+        while (high - low > 1) {
+            std::time_t middle = low + (high - low) / 2;
+            if (computeOffset(middle) == offsetAtStart) {
+                low = middle;
+            } else {
+                high = middle;
+            }
+        }
+        offsets.transition = high;
+        offsets.offsetAfter = offsetAtEnd;
+    }
+    
+    // Полночь в (dayStart, nextDayStart]; в поясе UTC она совпадает с концом суток
+    offsets.localDayAtStart = floorDiv(static_cast<long long>(dayStart) + offsetAtStart, DAY_SECONDS);
+    std::time_t midnight = computeNextLocalMidnight(dayStart);
+    offsets.midnight = midnight <= nextDayStart ? midnight : nextDayStart;
+    offsets.localDayAfter = offsets.localDayAtStart;
+    if (midnight <= nextDayStart) {
+        offsets.localDayAfter = floorDiv(static_cast<long long>(midnight) + computeOffset(midnight), DAY_SECONDS);
+    }
+    return offsets;
+}
+
+// Пустой кэш
+LocalTimeCache::LocalTimeCache() : firstUtcDay(0) {
+}
+
+// Заполнить кэш для [from, to]
+LocalTimeCache::LocalTimeCache(std::time_t from, std::time_t to) : firstUtcDay(0) {
+    cover(from, to);
+}
+
+// Расширить кэш: недостающие сутки добавляются в начало или в конец таблицы
+// Если для этого нужно больше MAX_EXTENSION_DAYS суток (включая промежуток между
+// кэшем и диапазоном), кэш не меняется: запросы вне него вычисляются напрямую.
+bool LocalTimeCache::cover(std::time_t from, std::time_t to) {
+    long long fromDay = floorDiv(static_cast<long long>(from), DAY_SECONDS);
+    long long toDay = floorDiv(static_cast<long long>(to), DAY_SECONDS);
+    if (toDay < fromDay) {
+        return true;
+    }
+    long long newDays = toDay - fromDay + 1;
+    if (!days.empty()) {
+        long long lastUtcDay = firstUtcDay + static_cast<long long>(days.size()) - 1;
+        newDays = std::max(0LL, firstUtcDay - fromDay) + std::max(0LL, toDay - lastUtcDay);
+    }
+    if (newDays > MAX_EXTENSION_DAYS) {
+        return false;
+    }
+    if (days.empty()) {
+        firstUtcDay = fromDay;
+    }
+    
+    if (fromDay < firstUtcDay) {
+        std::vector<DayOffsets> earlier;
+        earlier.reserve(static_cast<size_t>(firstUtcDay - fromDay) + days.size());
+        for (long long day = fromDay; day < firstUtcDay; ++day) {
+            earlier.push_back(computeDay(day));
+        }
+        earlier.insert(earlier.end(), days.begin(), days.end());
+        days.swap(earlier);
+        firstUtcDay = fromDay;
+    }
+    for (long long day = firstUtcDay + static_cast<long long>(days.size()); day <= toDay; ++day) {
+        days.push_back(computeDay(day));
+    }
+    return true;
+}
+
+// Сутки UTC из кэша
+const LocalTimeCache::DayOffsets* LocalTimeCache::findDay(std::time_t time) const {
+    long long index = floorDiv(static_cast<long long>(time), DAY_SECONDS) - firstUtcDay;
+    if (index < 0 || index >= static_cast<long long>(days.size())) {
+        return nullptr;
+    }
+    return &days[static_cast<size_t>(index)];
+}
+
+// Смещение местного времени от UTC
+long LocalTimeCache::getUtcOffset(std::time_t time) const {
+    const DayOffsets* day = findDay(time);
+    if (!day) {
+        return computeOffset(time);
+    }
+    return time < day->transition ? day->offsetAtStart : day->offsetAfter;
+}
+
+// Номер местных суток
+long long LocalTimeCache::getLocalDay(std::time_t time) const {
+    const DayOffsets* day = findDay(time);
+    if (!day) {
+        return floorDiv(static_cast<long long>(time) + computeOffset(time), DAY_SECONDS);
+    }
+    return time < day->midnight ? day->localDayAtStart : day->localDayAfter;
+}
+
+// Ближайшая местная полночь после time: полночь текущих или следующих суток UTC
+std::time_t LocalTimeCache::getNextLocalMidnight(std::time_t time) const {
+    const DayOffsets* day = findDay(time);
+    const DayOffsets* end = days.data() + days.size();
+    for (; day && day != end; ++day) {
+        if (time < day->midnight && day->localDayAfter != day->localDayAtStart) {
+            return day->midnight;
+        }
+    }
+    return computeNextLocalMidnight(time);
+}
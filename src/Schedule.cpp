@@ -1,22 +1,54 @@
 #include "Schedule.h"
+#include "LocalTimeCache.h"
 #include <algorithm>
 #include <sstream>
 #include <iomanip>
 #include <ctime>
-#include <map>
+#include <thread>
+#include <unordered_map>
 
 // Конструктор по умолчанию
-Schedule::Schedule() {
+Schedule::Schedule()
+    : clock(std::make_shared<SystemClock>()), cargoDeadlines(std::make_shared<CargoDeadlineIndex>()),
+      statusTracker(clock->now()), minGroundTime(0), chainCheckEnabled(false),
+      version(0), changeLogLimit(DEFAULT_CHANGE_LOG_LIMIT) {
+}
+
+// Копии рейсов списка: перенос и передача самолёту меняют рейс на месте,
+// поэтому копии расписания не должны делить объекты рейсов
+static Schedule::FlightList copyFlightList(const Schedule::FlightList& source) {
+    Schedule::FlightList result;
+    result.reserve(source.size());
+    for (const auto& flight : source) {
+        result.push_back(flight ? std::make_shared<Flight>(*flight) : nullptr);
+    }
+    return result;
 }
 
 // Конструктор копирования
-Schedule::Schedule(const Schedule& other) : flights(other.flights) {
+Schedule::Schedule(const Schedule& other)
+    : flights(copyFlightList(other.flights)), clock(other.clock), cargoDeadlines(other.cargoDeadlines), statusTracker(clock->now()),
+      minGroundTime(other.minGroundTime), aircraftGroundTime(other.aircraftGroundTime),
+      airportGroundTime(other.airportGroundTime), chainCheckEnabled(other.chainCheckEnabled),
+      version(other.version), changeLog(other.changeLog), changeLogLimit(other.changeLogLimit) {
+    rebuildIndexes();
 }
 
 // Оператор присваивания
 Schedule& Schedule::operator=(const Schedule& other) {
     if (this != &other) {
-        flights = other.flights;
+        flights = copyFlightList(other.flights);
+        clock = other.clock;
+        cargoDeadlines = other.cargoDeadlines;
+        minGroundTime = other.minGroundTime;
+        aircraftGroundTime = other.aircraftGroundTime;
+        airportGroundTime = other.airportGroundTime;
+        chainCheckEnabled = other.chainCheckEnabled;
+        rebuildIndexes();
+        // Содержимое заменено целиком: версия растёт, прежний журнал к нему не относится
+        version = std::max(version, other.version) + 1;
+        changeLogLimit = other.changeLogLimit;
+        resetChangeLog();
     }
     return *this;
 }
@@ -26,56 +58,753 @@ Schedule::~Schedule() {
     // Деструктор пустой, так как мы используем shared_ptr
 }
 
+// Сравнение рейсов по времени отправления (для упорядочивания расписания)
+static bool departsEarlier(const std::shared_ptr<Flight>& a, const std::shared_ptr<Flight>& b) {
+    if (!a || !b) return false;
+    return *a < *b;  // Используем оператор сравнения Flight
+}
+
+// Сравнение рейса с моментом времени по вылету (для двоичного поиска)
+struct DepartureOrder {
+    bool operator()(const std::shared_ptr<Flight>& flight, std::time_t time) const {
+        return flight->getDepartureTime() < time;
+    }
+    bool operator()(std::time_t time, const std::shared_ptr<Flight>& flight) const {
+        return time < flight->getDepartureTime();
+    }
+};
+
+// Вставить рейс в упорядоченный по вылету список (после рейсов с тем же временем)
+// Возвращает позицию вставленного рейса
+static size_t insertSorted(Schedule::FlightList& list, const std::shared_ptr<Flight>& flight) {
+    auto position = list.insert(std::upper_bound(list.begin(), list.end(), flight, departsEarlier), flight);
+    return static_cast<size_t>(position - list.begin());
+}
+
+// Найти позицию рейса в упорядоченном по вылету списке
+// Рейс ищется среди рейсов с тем же временем вылета; если время было изменено
+// в обход расписания, выполняется линейный поиск.
+template <class List>
+static auto findInList(List& list, const Flight* flight) -> decltype(list.begin()) {
+    auto range = std::equal_range(list.begin(), list.end(), flight->getDepartureTime(), DepartureOrder());
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->get() == flight) {
+            return it;
+        }
+    }
+    return std::find_if(list.begin(), list.end(),
+        [flight](const std::shared_ptr<Flight>& candidate) { return candidate.get() == flight; });
+}
+
+// Удалить рейс из упорядоченного списка
+static void eraseFromList(Schedule::FlightList& list, const Flight* flight) {
+    auto position = findInList(list, flight);
+    if (position != list.end()) {
+        list.erase(position);
+    }
+}
+
+// Вернуть рейс с изменённым временем вылета на место в упорядоченном списке
+// Сдвигается только участок между старой и новой позицией рейса; возвращается новая позиция
+static size_t repositionInList(Schedule::FlightList& list, Schedule::FlightList::iterator position) {
+    auto next = position + 1;
+    auto target = std::upper_bound(next, list.end(), *position, departsEarlier);
+    if (target != next) {
+        std::rotate(position, next, target);
+        return static_cast<size_t>(target - list.begin()) - 1;
+    }
+    target = std::upper_bound(list.begin(), position, *position, departsEarlier);
+    std::rotate(target, position, next);
+    return static_cast<size_t>(target - list.begin());
+}
+
+// Выполнить body(begin, end) для частей диапазона [0, count) в нескольких потоках
+// Число потоков ограничено объёмом работы: небольшие расписания обрабатываются
+// в вызывающем потоке.
+template <class Body>
+static void parallelRanges(size_t count, size_t flightCount, Body body) {
+    const size_t MIN_FLIGHTS_PER_THREAD = 20000;
+    size_t threadCount = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()),
+                                          flightCount / MIN_FLIGHTS_PER_THREAD);
+    if (threadCount <= 1) {
+        body(size_t(0), count);
+        return;
+    }
+    std::vector<std::thread> workers;
+    size_t chunk = (count + threadCount - 1) / threadCount;
+    for (size_t begin = 0; begin < count; begin += chunk) {
+        workers.emplace_back(body, begin, std::min(count, begin + chunk));
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+// Добавить рейс в список своего самолёта и в накопленные суммы полётов
+void Schedule::addToAircraftList(const std::shared_ptr<Flight>& flight) {
+    const std::string aircraftId = flight->getAircraftId();
+    size_t position = insertSorted(aircraftFlights[aircraftId], flight);
+    
+    // Накопленные суммы: новый элемент после позиции рейса, хвост сдвигается на его длительность
+    std::vector<long long>& seconds = aircraftFlightSeconds[aircraftId];
+    if (seconds.empty()) {
+        seconds.push_back(0);
+    }
+    long long duration = static_cast<long long>(flight->getFlightDuration());
+    seconds.insert(seconds.begin() + position + 1, seconds[position] + duration);
+    for (size_t i = position + 2; i < seconds.size(); ++i) {
+        seconds[i] += duration;
+    }
+}
+
+// Убрать рейс из списка его самолёта; пустой список удаляется
+void Schedule::removeFromAircraftList(const std::shared_ptr<Flight>& flight) {
+    const std::string aircraftId = flight->getAircraftId();
+    auto aircraft = aircraftFlights.find(aircraftId);
+    if (aircraft == aircraftFlights.end()) {
+        return;
+    }
+    FlightList& list = aircraft->second;
+    auto position = findInList(list, flight.get());
+    if (position != list.end()) {
+        // Вычитаем длительность из сумм после рейса; берём её из самих сумм,
+        // так как время рейса могло быть изменено после добавления
+        std::vector<long long>& seconds = aircraftFlightSeconds[aircraftId];
+        size_t index = static_cast<size_t>(position - list.begin());
+        long long duration = seconds[index + 1] - seconds[index];
+        seconds.erase(seconds.begin() + index + 1);
+        for (size_t i = index + 1; i < seconds.size(); ++i) {
+            seconds[i] -= duration;
+        }
+        list.erase(position);
+    }
+    if (list.empty()) {
+        aircraftFlights.erase(aircraft);
+        aircraftFlightSeconds.erase(aircraftId);
+    }
+}
+
+// Добавить рейс в вторичные индексы (по самолёту и по аэропортам)
+void Schedule::indexFlight(const std::shared_ptr<Flight>& flight) {
+    addToAircraftList(flight);
+    insertSorted(airportFlights[flight->getDepartureAirport()], flight);
+    if (flight->getDestinationAirport() != flight->getDepartureAirport()) {
+        insertSorted(airportFlights[flight->getDestinationAirport()], flight);
+    }
+    updateDuty(*flight, +1);
+    statusTracker.add(flight.get());
+    scheduleFlightEvents(flight);
+}
+
+// Убрать рейс из вторичных индексов; пустые списки удаляются
+void Schedule::unindexFlight(const std::shared_ptr<Flight>& flight) {
+    auto removeFrom = [&flight](std::unordered_map<std::string, FlightList>& index, const std::string& key) {
+        auto it = index.find(key);
+        if (it != index.end()) {
+            eraseFromList(it->second, flight.get());
+            if (it->second.empty()) {
+                index.erase(it);
+            }
+        }
+    };
+    
+    removeFromAircraftList(flight);
+    removeFrom(airportFlights, flight->getDepartureAirport());
+    removeFrom(airportFlights, flight->getDestinationAirport());
+    updateDuty(*flight, -1);
+    statusTracker.remove(flight.get());
+    cancelFlightEvents(flight.get());
+}
+
 // Добавить рейс в расписание
-void Schedule::addFlight(std::shared_ptr<Flight> flight) {
-    if (flight && flight->isValid()) {
+// Рейс вставляется в позицию upper_bound по времени вылета, поэтому порядок
+// сохраняется без полной пересортировки: поиск O(log n), но вставка сдвигает хвост
+// общего списка, списков самолёта и аэропортов и накопленных сумм — O(n) на рейс.
+// Загрузка n рейсов в произвольном порядке по одному стоит O(n^2); для пакетов
+// следует вызывать addFlights (одна сортировка и слияние).
+// Номер рейса должен быть уникальным: рейс с уже занятым номером отклоняется.
+bool Schedule::addFlight(std::shared_ptr<Flight> flight) {
+    if (!flight || !flight->isValid()) {
+        return false;
+    }
+    if (!flightIndex.emplace(flight->getFlightNumber(), flight).second) {
+        return false;  // Дубликат номера рейса
+    }
+    
+    insertSorted(flights, flight);
+    indexFlight(flight);
+    recordChange(ScheduleChangeType::Added, *flight);
+    return true;
+}
+
+// Проверить рейс перед добавлением
+// Рейсы самолёта упорядочены по вылету, поэтому соседи нового рейса находятся
+// двоичным поиском: предшественник — последний рейс с вылетом не позже нового,
+// преемник — следующий за ним. Если рейсы самолёта между собой не пересекаются
+// (например, все добавлены через tryAddFlight), проверки соседей достаточно:
+// пересечение или короткая стоянка с более дальним рейсом означали бы то же с соседом.
+FlightCheckResult Schedule::checkFlight(const Flight& flight) const {
+    if (!flight.isValid()) {
+        return {FlightCheckStatus::InvalidFlight, ""};
+    }
+    if (flightIndex.find(flight.getFlightNumber()) != flightIndex.end()) {
+        return {FlightCheckStatus::DuplicateNumber, flight.getFlightNumber()};
+    }
+    
+    const FlightList& list = getFlightsByAircraftRef(flight.getAircraftId());
+    auto next = std::upper_bound(list.begin(), list.end(), flight.getDepartureTime(), DepartureOrder());
+    return checkNeighbours(next != list.begin() ? (next - 1)->get() : nullptr, flight,
+                           next != list.end() ? next->get() : nullptr);
+}
+
+// Проверить рейс с предшественником и преемником в списке его самолёта
+FlightCheckResult Schedule::checkNeighbours(const Flight* previous, const Flight& flight, const Flight* following) const {
+    auto toStatus = [](ConflictType type) {
+        return type == ConflictType::Turnaround ? FlightCheckStatus::Turnaround : FlightCheckStatus::Chain;
+    };
+    std::time_t groundTime = aircraftMinGroundTime(flight.getAircraftId());
+    ConflictType type;
+    if (previous) {
+        if (previous->getArrivalTime() > flight.getDepartureTime()) {
+            return {FlightCheckStatus::Overlap, previous->getFlightNumber()};
+        }
+        if (violatesSequence(*previous, flight, groundTime, type)) {
+            return {toStatus(type), previous->getFlightNumber()};
+        }
+    }
+    if (following) {
+        if (following->getDepartureTime() < flight.getArrivalTime()) {
+            return {FlightCheckStatus::Overlap, following->getFlightNumber()};
+        }
+        if (violatesSequence(flight, *following, groundTime, type)) {
+            return {toStatus(type), following->getFlightNumber()};
+        }
+    }
+    return {FlightCheckStatus::Ok, ""};
+}
+
+// Добавить рейс с проверкой конфликтов: O(log n) на проверку плюс вставка как в addFlight
+FlightCheckResult Schedule::tryAddFlight(std::shared_ptr<Flight> flight) {
+    if (!flight) {
+        return {FlightCheckStatus::InvalidFlight, ""};
+    }
+    FlightCheckResult result = checkFlight(*flight);
+    if (result.status == FlightCheckStatus::Ok) {
+        addFlight(flight);
+    }
+    return result;
+}
+
+// Перенести рейс на новое время
+// Рейс не удаляется из списков: в каждом упорядоченном списке (общем, самолёта,
+// аэропортов) он переставляется поворотом участка между старой и новой позицией,
+// поэтому при переносе на близкое время сдвигается лишь несколько элементов.
+// Конфликты проверяются только с новыми соседями по самолёту; при конфликте
+// рейс возвращается на прежнее время (если rejectConflicts = false — переносится,
+// а конфликт только сообщается). Накопленные суммы пересчитываются на
+// затронутом участке, суточный налёт, счётчики статусов и таймеры событий
+// обновляются для одного рейса.
+FlightCheckResult Schedule::rescheduleFlight(const std::string& flightNumber, std::time_t newDeparture, std::time_t newArrival,
+                                             bool rejectConflicts) {
+    auto indexed = flightIndex.find(flightNumber);
+    if (indexed == flightIndex.end()) {
+        return {FlightCheckStatus::NotFound, ""};
+    }
+    if (newArrival <= newDeparture) {
+        return {FlightCheckStatus::InvalidFlight, ""};
+    }
+    
+    std::shared_ptr<Flight> flight = indexed->second;
+    const std::string aircraftId = flight->getAircraftId();
+    auto aircraft = aircraftFlights.find(aircraftId);
+    if (aircraft == aircraftFlights.end()) {
+        return {FlightCheckStatus::NotFound, ""};
+    }
+    FlightList& list = aircraft->second;
+    auto position = findInList(list, flight.get());
+    if (position == list.end()) {
+        return {FlightCheckStatus::NotFound, ""};
+    }
+    size_t oldIndex = static_cast<size_t>(position - list.begin());
+    std::time_t oldDeparture = flight->getDepartureTime();
+    std::time_t oldArrival = flight->getArrivalTime();
+    
+    updateDuty(*flight, -1);
+    statusTracker.remove(flight.get());
+    cancelFlightEvents(flight.get());
+    
+    // Позиции в общем списке и списках аэропортов ищутся по старому времени
+    auto flightsPosition = findInList(flights, flight.get());
+    FlightList& departures = airportFlights[flight->getDepartureAirport()];
+    auto departurePosition = findInList(departures, flight.get());
+    FlightList* arrivals = nullptr;
+    FlightList::iterator arrivalPosition;
+    if (flight->getDestinationAirport() != flight->getDepartureAirport()) {
+        arrivals = &airportFlights[flight->getDestinationAirport()];
+        arrivalPosition = findInList(*arrivals, flight.get());
+    }
+    
+    flight->setDepartureTime(newDeparture);
+    flight->setArrivalTime(newArrival);
+    size_t newIndex = repositionInList(list, position);
+    FlightCheckResult result = checkNeighbours(newIndex > 0 ? list[newIndex - 1].get() : nullptr, *flight,
+                                               newIndex + 1 < list.size() ? list[newIndex + 1].get() : nullptr);
+    if (result.status != FlightCheckStatus::Ok && rejectConflicts) {
+        flight->setDepartureTime(oldDeparture);
+        flight->setArrivalTime(oldArrival);
+        newIndex = repositionInList(list, list.begin() + newIndex);
+    } else {
+        if (flightsPosition != flights.end()) {
+            repositionInList(flights, flightsPosition);
+        }
+        if (departurePosition != departures.end()) {
+            repositionInList(departures, departurePosition);
+        }
+        if (arrivals && arrivalPosition != arrivals->end()) {
+            repositionInList(*arrivals, arrivalPosition);
+        }
+    }
+    
+    // Суммы до участка [first, last] не меняются, внутри пересчитываются,
+    // после него сдвигаются на изменение длительности рейса
+    std::vector<long long>& seconds = aircraftFlightSeconds[aircraftId];
+    size_t first = std::min(oldIndex, newIndex);
+    size_t last = std::max(oldIndex, newIndex);
+    long long delta = static_cast<long long>(flight->getFlightDuration()) - (seconds[oldIndex + 1] - seconds[oldIndex]);
+    for (size_t i = first; i <= last; ++i) {
+        seconds[i + 1] = seconds[i] + static_cast<long long>(list[i]->getFlightDuration());
+    }
+    if (delta != 0) {
+        for (size_t i = last + 2; i < seconds.size(); ++i) {
+            seconds[i] += delta;
+        }
+    }
+    
+    updateDuty(*flight, +1);
+    statusTracker.add(flight.get());
+    scheduleFlightEvents(flight);
+    if (result.status == FlightCheckStatus::Ok || !rejectConflicts) {
+        recordChange(ScheduleChangeType::Rescheduled, *flight);
+    }
+    return result;
+}
+
+// Передать рейс другому самолёту
+// Время рейса не меняется, поэтому общий список, списки аэропортов, счётчики
+// статусов и таймеры событий не затрагиваются: рейс переходит из списка прежнего
+// самолёта в список нового после проверки соседей. При конфликте или том же
+// самолёте расписание, налёт и журнал не меняются.
+FlightCheckResult Schedule::reassignAircraft(const std::string& flightNumber, const std::string& newAircraftId) {
+    auto indexed = flightIndex.find(flightNumber);
+    if (indexed == flightIndex.end()) {
+        return {FlightCheckStatus::NotFound, ""};
+    }
+    if (newAircraftId.empty()) {
+        return {FlightCheckStatus::InvalidFlight, ""};
+    }
+    
+    std::shared_ptr<Flight> flight = indexed->second;
+    if (flight->getAircraftId() == newAircraftId) {
+        return {FlightCheckStatus::Ok, ""};
+    }
+    
+    // Соседи проверяются до изменения: рейс нового самолёта ещё не содержит
+    Flight candidate(*flight);
+    candidate.setAircraftId(newAircraftId);
+    const FlightList& list = getFlightsByAircraftRef(newAircraftId);
+    auto next = std::upper_bound(list.begin(), list.end(), candidate.getDepartureTime(), DepartureOrder());
+    FlightCheckResult result = checkNeighbours(next != list.begin() ? (next - 1)->get() : nullptr, candidate,
+                                               next != list.end() ? next->get() : nullptr);
+    if (result.status != FlightCheckStatus::Ok) {
+        return result;
+    }
+    
+    updateDuty(*flight, -1);
+    removeFromAircraftList(flight);
+    flight->setAircraftId(newAircraftId);
+    addToAircraftList(flight);
+    updateDuty(*flight, +1);
+    recordChange(ScheduleChangeType::Reassigned, *flight);
+    return result;
+}
+
+// Добавить несколько рейсов за одну операцию
+// Корректные рейсы сортируются по вылету (по ключу, без обращения к объектам),
+// дописываются в конец каждого затронутого списка и сливаются с его уже
+// упорядоченной частью одним std::inplace_merge: O(n + m log m).
+// Рейсы с занятыми номерами (в том числе повторы внутри пакета) пропускаются;
+// если передан statuses, в него записывается итог по каждому рейсу пакета
+// (Ok, InvalidFlight или DuplicateNumber).
+int Schedule::addFlights(const std::vector<std::shared_ptr<Flight>>& newFlights, std::vector<FlightCheckStatus>* statuses) {
+    std::vector<std::pair<std::time_t, std::shared_ptr<Flight>>> accepted;
+    accepted.reserve(newFlights.size());
+    flightIndex.reserve(flightIndex.size() + newFlights.size());
+    if (statuses) {
+        statuses->assign(newFlights.size(), FlightCheckStatus::Ok);
+    }
+    for (size_t i = 0; i < newFlights.size(); ++i) {
+        const auto& flight = newFlights[i];
+        FlightCheckStatus status = FlightCheckStatus::Ok;
+        if (!flight || !flight->isValid()) {
+            status = FlightCheckStatus::InvalidFlight;
+        } else if (!flightIndex.emplace(flight->getFlightNumber(), flight).second) {
+            status = FlightCheckStatus::DuplicateNumber;
+        } else {
+            accepted.emplace_back(flight->getDepartureTime(), flight);
+        }
+        if (statuses) {
+            (*statuses)[i] = status;
+        }
+    }
+    std::stable_sort(accepted.begin(), accepted.end(),
+        [](const std::pair<std::time_t, std::shared_ptr<Flight>>& a,
+           const std::pair<std::time_t, std::shared_ptr<Flight>>& b) { return a.first < b.first; });
+    
+    // Для каждого затронутого списка запоминаем его размер до добавления;
+    // дописываемые хвосты уже упорядочены, так как пакет отсортирован
+    std::vector<std::pair<FlightList*, size_t>> touchedLists;
+    std::unordered_map<FlightList*, bool> seenLists;
+    auto appendTo = [&](FlightList& list, const std::shared_ptr<Flight>& flight) {
+        if (seenLists.emplace(&list, true).second) {
+            touchedLists.emplace_back(&list, list.size());
+        }
+        list.push_back(flight);
+    };
+    
+    touchedLists.emplace_back(&flights, flights.size());
+    flights.reserve(flights.size() + accepted.size());
+    for (const auto& entry : accepted) {
+        const auto& flight = entry.second;
         flights.push_back(flight);
-        sortFlights();  // Сортируем после добавления
+        appendTo(aircraftFlights[flight->getAircraftId()], flight);
+        appendTo(airportFlights[flight->getDepartureAirport()], flight);
+        if (flight->getDestinationAirport() != flight->getDepartureAirport()) {
+            appendTo(airportFlights[flight->getDestinationAirport()], flight);
+        }
+        updateDuty(*flight, +1);
+        statusTracker.add(flight.get());
+        scheduleFlightEvents(flight);
+        recordChange(ScheduleChangeType::Added, *flight);
+    }
+    
+    for (const auto& touched : touchedLists) {
+        FlightList& list = *touched.first;
+        size_t sortedSize = touched.second;
+        // Слияние не нужно, если хвост целиком не раньше последнего старого рейса
+        if (sortedSize > 0 && sortedSize < list.size() &&
+            departsEarlier(list[sortedSize], list[sortedSize - 1])) {
+            std::inplace_merge(list.begin(), list.begin() + sortedSize, list.end(), departsEarlier);
+        }
+    }
+    
+    // Накопленные суммы пересчитываются один раз для каждого затронутого самолёта
+    for (auto& aircraft : aircraftFlights) {
+        if (seenLists.count(&aircraft.second) != 0) {
+            rebuildFlightSeconds(aircraft.first);
+        }
     }
+    
+    return static_cast<int>(accepted.size());
 }
 
 // Удалить рейс из расписания
 void Schedule::removeFlight(const std::string& flightNumber) {
-    flights.erase(
-        std::remove_if(flights.begin(), flights.end(),
-            [&flightNumber](const std::shared_ptr<Flight>& flight) {
-                return flight && flight->getFlightNumber() == flightNumber;
-            }),
-        flights.end()
-    );
+    auto indexed = flightIndex.find(flightNumber);
+    if (indexed == flightIndex.end()) {
+        return;
+    }
+    
+    std::shared_ptr<Flight> flight = indexed->second;
+    eraseFromList(flights, flight.get());
+    unindexFlight(flight);
+    flightIndex.erase(indexed);
+    recordChange(ScheduleChangeType::Removed, *flight);
 }
 
-// Найти рейс по номеру
+// Найти рейс по номеру (O(1) по хеш-индексу)
 std::shared_ptr<Flight> Schedule::findFlight(const std::string& flightNumber) const {
-    auto it = std::find_if(flights.begin(), flights.end(),
-        [&flightNumber](const std::shared_ptr<Flight>& flight) {
-            return flight && flight->getFlightNumber() == flightNumber;
-        });
-    
-    return (it != flights.end()) ? *it : nullptr;
+    auto it = flightIndex.find(flightNumber);
+    return (it != flightIndex.end()) ? it->second : nullptr;
+}
+
+// Перестроить индексы по текущему (упорядоченному) списку рейсов
+void Schedule::rebuildIndexes() {
+    flightIndex.clear();
+    aircraftFlights.clear();
+    aircraftFlightSeconds.clear();
+    airportFlights.clear();
+    statusTracker.clear();
+    for (const auto& timers : flightTimers) {
+        events->cancel(timers.second.first);
+        events->cancel(timers.second.second);
+    }
+    flightTimers.clear();
+    flightIndex.reserve(flights.size());
+    for (const auto& flight : flights) {
+        if (flight) {
+            flightIndex.emplace(flight->getFlightNumber(), flight);
+            statusTracker.add(flight.get());
+            scheduleFlightEvents(flight);
+            // Рейсы перебираются в порядке вылета, поэтому списки остаются упорядоченными
+            aircraftFlights[flight->getAircraftId()].push_back(flight);
+            airportFlights[flight->getDepartureAirport()].push_back(flight);
+            if (flight->getDestinationAirport() != flight->getDepartureAirport()) {
+                airportFlights[flight->getDestinationAirport()].push_back(flight);
+            }
+        }
+    }
+    for (const auto& aircraft : aircraftFlights) {
+        rebuildFlightSeconds(aircraft.first);
+    }
+    rebuildDuty();
+}
+
+// Пересчитать накопленные секунды полётов по списку рейсов самолёта
+void Schedule::rebuildFlightSeconds(const std::string& aircraftId) {
+    const FlightList& list = getFlightsByAircraftRef(aircraftId);
+    std::vector<long long>& seconds = aircraftFlightSeconds[aircraftId];
+    seconds.assign(1, 0);
+    seconds.reserve(list.size() + 1);
+    for (const auto& flight : list) {
+        seconds.push_back(seconds.back() + static_cast<long long>(flight->getFlightDuration()));
+    }
 }
 
 // Отсортировать рейсы по времени отправления
 void Schedule::sortFlights() {
-    std::sort(flights.begin(), flights.end(),
-        [](const std::shared_ptr<Flight>& a, const std::shared_ptr<Flight>& b) {
-            if (!a || !b) return false;
-            return *a < *b;  // Используем оператор сравнения Flight
-        });
+    // Устойчивая сортировка сохраняет порядок добавления рейсов с одинаковым временем вылета
+    std::stable_sort(flights.begin(), flights.end(), departsEarlier);
+}
+
+// Получить индекс рейса в списке getFlights()
+size_t Schedule::getFlightPosition(const Flight* flight) const {
+    return static_cast<size_t>(findInList(flights, flight) - flights.begin());
+}
+
+// Рейсы одного самолёта в порядке вылета
+// Список уже упорядочен, если рейсы не менялись в обход расписания.
+static std::vector<const Flight*> sortedGroup(const Schedule::FlightList& list) {
+    std::vector<const Flight*> group;
+    group.reserve(list.size());
+    for (const auto& flight : list) {
+        group.push_back(flight.get());
+    }
+    auto byDeparture = [](const Flight* a, const Flight* b) {
+        return a->getDepartureTime() < b->getDepartureTime();
+    };
+    if (!std::is_sorted(group.begin(), group.end(), byDeparture)) {
+        std::stable_sort(group.begin(), group.end(), byDeparture);
+    }
+    return group;
 }
 
 // Проверить наличие конфликтов в расписании
+// Интервалы каждого самолёта берутся из индекса по самолётам и просматриваются
+// одним проходом в порядке вылета (sweep line) вместо попарного сравнения всех рейсов;
+// в том же проходе проверяются стоянки и маршрут соседних рейсов.
 bool Schedule::hasConflicts() const {
-    for (size_t i = 0; i < flights.size(); ++i) {
-        for (size_t j = i + 1; j < flights.size(); ++j) {
-            if (flights[i] && flights[j] && flights[i]->conflictsWith(*flights[j])) {
+    for (const auto& entry : aircraftFlights) {
+        if (hasConflictsInGroup(entry.first, sortedGroup(entry.second))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Проверить наличие конфликтов среди рейсов одного самолёта
+// Пересечения: семантика совпадает с Flight::conflictsWith — рейсы a и b конфликтуют,
+// если a.departure < b.arrival и b.departure < a.arrival. Стоянка и маршрут
+// проверяются для соседних по вылету рейсов (см. violatesSequence).
+bool Schedule::hasConflictsInGroup(const std::string& aircraftId, const std::vector<const Flight*>& group) const {
+    std::time_t groundTime = aircraftMinGroundTime(aircraftId);
+    ConflictType type;
+    // prefixMaxArrival[i] - максимальное время прибытия среди первых i + 1 рейсов
+    std::vector<std::time_t> prefixMaxArrival(group.size());
+    for (size_t i = 0; i < group.size(); ++i) {
+        std::time_t departure = group[i]->getDepartureTime();
+        std::time_t arrival = group[i]->getArrivalTime();
+        
+        if (i > 0) {
+            if (violatesSequence(*group[i - 1], *group[i], groundTime, type)) {
                 return true;
             }
+            if (arrival > departure) {
+                // Для любого предшественника p: p.departure <= departure < arrival,
+                // поэтому достаточно проверить, что кто-то из них прибывает позже вылета
+                if (prefixMaxArrival[i - 1] > departure) {
+                    return true;
+                }
+            } else {
+                // Некорректный интервал (arrival <= departure): конфликтовать могут
+                // только предшественники, вылетевшие раньше arrival
+                auto bound = std::lower_bound(group.begin(), group.begin() + i, arrival,
+                    [](const Flight* f, std::time_t t) { return f->getDepartureTime() < t; });
+                size_t count = static_cast<size_t>(bound - group.begin());
+                if (count > 0 && prefixMaxArrival[count - 1] > departure) {
+                    return true;
+                }
+            }
         }
+        
+        prefixMaxArrival[i] = (i > 0) ? std::max(prefixMaxArrival[i - 1], arrival) : arrival;
     }
     return false;
 }
 
+// Найти все конфликты
+// Для каждого самолёта поддерживается множество "активных" рейсов (ещё не
+// прибывших к моменту очередного вылета) в виде min-кучи по времени прибытия.
+// Каждый активный рейс даёт конфликтную пару, поэтому работа O(n log n + k),
+// где k - количество найденных пар. Стоянка и маршрут проверяются в том же
+// проходе для каждой пары соседних по вылету рейсов.
+std::vector<FlightConflict> Schedule::getConflicts() const {
+    std::vector<FlightConflict> conflicts;
+    
+    // Элемент кучи: (время прибытия, рейс)
+    using ActiveFlight = std::pair<std::time_t, const Flight*>;
+    auto laterArrival = [](const ActiveFlight& a, const ActiveFlight& b) { return a.first > b.first; };
+    std::vector<ActiveFlight> active;
+    
+    // Позиции в getFlights() нужны только для рейсов, попавших в конфликты
+    std::unordered_map<const Flight*, size_t> positions;
+    auto positionOf = [this, &positions](const Flight* flight) {
+        auto it = positions.find(flight);
+        if (it == positions.end()) {
+            it = positions.emplace(flight, getFlightPosition(flight)).first;
+        }
+        return it->second;
+    };
+    
+    auto addConflict = [&](const Flight* first, const Flight* second, ConflictType type) {
+        size_t a = positionOf(first);
+        size_t b = positionOf(second);
+        conflicts.push_back({std::min(a, b), std::max(a, b), type});
+    };
+    
+    ConflictType sequenceType;
+    for (const auto& entry : aircraftFlights) {
+        active.clear();
+        std::time_t groundTime = aircraftMinGroundTime(entry.first);
+        const Flight* previous = nullptr;
+        for (const Flight* flight : sortedGroup(entry.second)) {
+            std::time_t departure = flight->getDepartureTime();
+            std::time_t arrival = flight->getArrivalTime();
+            
+            // Рейсы, прибывшие не позже текущего вылета, не пересекутся и с последующими
+            while (!active.empty() && active.front().first <= departure) {
+                std::pop_heap(active.begin(), active.end(), laterArrival);
+                active.pop_back();
+            }
+            
+            for (const auto& other : active) {
+                // У корректного интервала пересечение гарантировано; для
+                // некорректного (arrival <= departure) проверяем вторую границу
+                if (arrival > departure || other.second->getDepartureTime() < arrival) {
+                    addConflict(other.second, flight, ConflictType::Overlap);
+                }
+            }
+            
+            if (previous) {
+                // Стоянка и маршрут независимы, поэтому пара может дать оба конфликта
+                if (violatesSequence(*previous, *flight, groundTime, sequenceType)) {
+                    addConflict(previous, flight, sequenceType);
+                    if (sequenceType == ConflictType::Turnaround && chainCheckEnabled &&
+                        previous->getDestinationAirport() != flight->getDepartureAirport()) {
+                        addConflict(previous, flight, ConflictType::Chain);
+                    }
+                }
+            }
+            previous = flight;
+            
+            active.emplace_back(arrival, flight);
+            std::push_heap(active.begin(), active.end(), laterArrival);
+        }
+    }
+    
+    std::sort(conflicts.begin(), conflicts.end(),
+        [](const FlightConflict& a, const FlightConflict& b) {
+            if (a.first != b.first) return a.first < b.first;
+            if (a.second != b.second) return a.second < b.second;
+            return a.type < b.type;
+        });
+    return conflicts;
+}
+
+// Стоянка самолёта без учёта аэропорта: максимум общего правила и правила самолёта
+std::time_t Schedule::aircraftMinGroundTime(const std::string& aircraftId) const {
+    auto it = aircraftGroundTime.find(aircraftId);
+    return it != aircraftGroundTime.end() ? std::max(minGroundTime, it->second) : minGroundTime;
+}
+
+// Проверить стоянку и маршрут соседних по вылету рейсов одного самолёта
+// Пересекающиеся пары здесь не рассматриваются (это конфликт Overlap).
+// Стоянка считается от прибытия previous до вылета next и должна быть не короче
+// максимума из правил самолёта и аэропорта прибытия previous.
+bool Schedule::violatesSequence(const Flight& previous, const Flight& next, std::time_t groundTime, ConflictType& type) const {
+    std::time_t gap = next.getDepartureTime() - previous.getArrivalTime();
+    if (gap < 0) {
+        return false;
+    }
+    if (!airportGroundTime.empty()) {
+        auto it = airportGroundTime.find(previous.getDestinationAirport());
+        if (it != airportGroundTime.end()) {
+            groundTime = std::max(groundTime, it->second);
+        }
+    }
+    if (gap < groundTime) {
+        type = ConflictType::Turnaround;
+        return true;
+    }
+    if (chainCheckEnabled && previous.getDestinationAirport() != next.getDepartureAirport()) {
+        type = ConflictType::Chain;
+        return true;
+    }
+    return false;
+}
+
+// Минимальная стоянка между рейсами любого самолёта
+void Schedule::setMinGroundTime(std::time_t seconds) {
+    minGroundTime = std::max<std::time_t>(0, seconds);
+}
+
+std::time_t Schedule::getMinGroundTime() const {
+    return minGroundTime;
+}
+
+// Минимальная стоянка самолёта (0 или меньше — снять правило)
+void Schedule::setAircraftMinGroundTime(const std::string& aircraftId, std::time_t seconds) {
+    if (seconds > 0) {
+        aircraftGroundTime[aircraftId] = seconds;
+    } else {
+        aircraftGroundTime.erase(aircraftId);
+    }
+}
+
+// Минимальная стоянка в аэропорту (0 или меньше — снять правило)
+void Schedule::setAirportMinGroundTime(const std::string& airportCode, std::time_t seconds) {
+    if (seconds > 0) {
+        airportGroundTime[airportCode] = seconds;
+    } else {
+        airportGroundTime.erase(airportCode);
+    }
+}
+
+// Действующая стоянка самолёта в аэропорту: самое строгое из правил
+std::time_t Schedule::getRequiredGroundTime(const std::string& aircraftId, const std::string& airportCode) const {
+    std::time_t groundTime = aircraftMinGroundTime(aircraftId);
+    auto it = airportGroundTime.find(airportCode);
+    return it != airportGroundTime.end() ? std::max(groundTime, it->second) : groundTime;
+}
+
+// Требовать вылет из аэропорта прибытия предыдущего рейса
+void Schedule::setChainCheckEnabled(bool enabled) {
+    chainCheckEnabled = enabled;
+}
+
+bool Schedule::isChainCheckEnabled() const {
+    return chainCheckEnabled;
+}
+
 // Проверить корректность расписания
 bool Schedule::isValid() const {
     // Проверяем, что все рейсы валидны
@@ -105,9 +834,22 @@ std::vector<std::string> Schedule::getValidationErrors() const {
         }
     }
     
-    // Проверяем конфликты
-    if (hasConflicts()) {
+    // Проверяем конфликты и перечисляем все конфликтующие пары
+    auto conflicts = getConflicts();
+    if (!conflicts.empty()) {
         errors.push_back("Schedule has conflicts between flights");
+        for (const auto& conflict : conflicts) {
+            const auto& first = flights[conflict.first];
+            const auto& second = flights[conflict.second];
+            const char* relation = " overlaps ";
+            if (conflict.type == ConflictType::Turnaround) {
+                relation = " leaves too little ground time before ";
+            } else if (conflict.type == ConflictType::Chain) {
+                relation = " does not connect to ";
+            }
+            errors.push_back("Conflict: " + first->getFlightNumber() + relation +
+                             second->getFlightNumber() + " (aircraft " + first->getAircraftId() + ")");
+        }
     }
     
     return errors;
@@ -115,6 +857,12 @@ std::vector<std::string> Schedule::getValidationErrors() const {
 
 // Проверить и исправить ошибки в расписании
 void Schedule::validateAndFix() {
+    for (const auto& flight : flights) {
+        if (flight && !flight->isValid()) {
+            recordChange(ScheduleChangeType::Removed, *flight);
+        }
+    }
+    
     // Удаляем невалидные рейсы
     flights.erase(
         std::remove_if(flights.begin(), flights.end(),
@@ -124,8 +872,62 @@ void Schedule::validateAndFix() {
         flights.end()
     );
     
-    // Сортируем после очистки
+    // Сортируем после очистки и обновляем индексы
     sortFlights();
+    rebuildIndexes();
+}
+
+// Увеличить версию и записать изменение рейса в журнал
+// Журнал хранит не более changeLogLimit последних записей; старые записи отбрасываются
+void Schedule::recordChange(ScheduleChangeType type, const Flight& flight) {
+    ++version;
+    if (changeLogLimit == 0) {
+        return;
+    }
+    changeLog.push_back(ScheduleChange{version, type, flight.getFlightNumber(), flight.getDepartureAirport(),
+                                       flight.getDestinationAirport(), flight.getAircraftId(),
+                                       flight.getDepartureTime(), flight.getArrivalTime(), flight.isCompleted()});
+    while (changeLog.size() > changeLogLimit) {
+        changeLog.pop_front();
+    }
+}
+
+// Начать журнал заново с текущей версии
+void Schedule::resetChangeLog() {
+    changeLog.clear();
+}
+
+// Текущая версия расписания
+std::uint64_t Schedule::getVersion() const {
+    return version;
+}
+
+// Изменения после версии sinceVersion в порядке версий (не более maxChanges)
+// Записи журнала идут подряд по версиям, поэтому начало выдачи вычисляется
+// без поиска. Если часть изменений уже вытеснена из журнала (или версия
+// не относится к этому расписанию), возвращается false: клиенту нужна полная загрузка.
+bool Schedule::getChangesSince(std::uint64_t sinceVersion, std::vector<ScheduleChange>& changes, size_t maxChanges) const {
+    changes.clear();
+    std::uint64_t oldest = version - changeLog.size();
+    if (sinceVersion < oldest || sinceVersion > version) {
+        return false;
+    }
+    size_t first = static_cast<size_t>(sinceVersion - oldest);
+    size_t count = std::min(maxChanges, changeLog.size() - first);
+    changes.assign(changeLog.begin() + first, changeLog.begin() + first + count);
+    return true;
+}
+
+// Наибольшее число записей журнала
+void Schedule::setChangeLogLimit(size_t limit) {
+    changeLogLimit = limit;
+    while (changeLog.size() > changeLogLimit) {
+        changeLog.pop_front();
+    }
+}
+
+size_t Schedule::getChangeLogLimit() const {
+    return changeLogLimit;
 }
 
 // Получить список всех рейсов
@@ -133,121 +935,275 @@ const std::vector<std::shared_ptr<Flight>>& Schedule::getFlights() const {
     return flights;
 }
 
-// Получить рейсы самолёта
+// Получить рейсы самолёта (O(k) по индексу самолётов)
 std::vector<std::shared_ptr<Flight>> Schedule::getFlightsByAircraft(const std::string& aircraftId) const {
-    std::vector<std::shared_ptr<Flight>> aircraftFlights;
-    
-    for (const auto& flight : flights) {
-        if (flight && flight->getAircraftId() == aircraftId) {
-            aircraftFlights.push_back(flight);
-        }
-    }
-    
-    return aircraftFlights;
+    auto it = aircraftFlights.find(aircraftId);
+    return (it != aircraftFlights.end()) ? it->second : FlightList();
 }
 
-// Получить рейсы аэропорта
+// Получить рейсы аэропорта (вылет или прилёт; O(k) по индексу аэропортов)
 std::vector<std::shared_ptr<Flight>> Schedule::getFlightsByAirport(const std::string& airportCode) const {
-    std::vector<std::shared_ptr<Flight>> airportFlights;
-    
-    for (const auto& flight : flights) {
-        if (flight && (flight->getDepartureAirport() == airportCode || 
-                       flight->getDestinationAirport() == airportCode)) {
-            airportFlights.push_back(flight);
-        }
+    auto it = airportFlights.find(airportCode);
+    return (it != airportFlights.end()) ? it->second : FlightList();
+}
+
+// Упорядоченный по вылету участок списка с вылетом в [startTime, endTime]
+static FlightRange departuresInRange(const Schedule::FlightList& list, std::time_t startTime, std::time_t endTime) {
+    if (startTime > endTime) {
+        return FlightRange(list.end(), list.end());
     }
-    
-    return airportFlights;
+    auto first = std::lower_bound(list.begin(), list.end(), startTime, DepartureOrder());
+    return FlightRange(first, std::upper_bound(first, list.end(), endTime, DepartureOrder()));
 }
 
-// Получить рейсы в временном диапазоне
-std::vector<std::shared_ptr<Flight>> Schedule::getFlightsInTimeRange(std::time_t startTime, std::time_t endTime) const {
-    std::vector<std::shared_ptr<Flight>> rangeFlights;
-    
-    for (const auto& flight : flights) {
-        if (flight && flight->getDepartureTime() >= startTime && 
-            flight->getDepartureTime() <= endTime) {
-            rangeFlights.push_back(flight);
-        }
+// Получить рейсы в временном диапазоне (двоичный поиск по упорядоченному списку)
+FlightRange Schedule::getFlightsInTimeRange(std::time_t startTime, std::time_t endTime) const {
+    return departuresInRange(flights, startTime, endTime);
+}
+
+// Получить рейсы аэропорта в временном диапазоне без копирования
+FlightRange Schedule::getFlightsByAirportInRange(const std::string& airportCode, std::time_t startTime, std::time_t endTime) const {
+    static const FlightList empty;
+    auto it = airportFlights.find(airportCode);
+    return departuresInRange(it != airportFlights.end() ? it->second : empty, startTime, endTime);
+}
+
+// Получить рейсы самолёта в временном диапазоне без копирования
+FlightRange Schedule::getFlightsByAircraftInRange(const std::string& aircraftId, std::time_t startTime, std::time_t endTime) const {
+    return aircraftFlightsInRange(aircraftId, startTime, endTime);
+}
+
+// Рейсы самолёта с вылетом в [startTime, endTime] (двоичный поиск по списку самолёта)
+FlightRange Schedule::aircraftFlightsInRange(const std::string& aircraftId, std::time_t startTime, std::time_t endTime) const {
+    return departuresInRange(getFlightsByAircraftRef(aircraftId), startTime, endTime);
+}
+
+// Секунды полётов самолёта по рейсам с вылетом в [startTime, endTime]:
+// два двоичных поиска по списку самолёта и разность накопленных сумм
+long long Schedule::flightSecondsInRange(const std::string& aircraftId, std::time_t startTime, std::time_t endTime) const {
+    auto it = aircraftFlightSeconds.find(aircraftId);
+    if (it == aircraftFlightSeconds.end() || startTime > endTime) {
+        return 0;
     }
-    
-    return rangeFlights;
+    const FlightList& list = getFlightsByAircraftRef(aircraftId);
+    auto first = std::lower_bound(list.begin(), list.end(), startTime, DepartureOrder());
+    auto last = std::upper_bound(first, list.end(), endTime, DepartureOrder());
+    return it->second[last - list.begin()] - it->second[first - list.begin()];
 }
 
-// Получить общее время полётов самолёта
+// Получить общее время полётов самолёта (O(1) по накопленным суммам)
 double Schedule::getTotalFlightTime(const std::string& aircraftId) const {
-    double totalTime = 0.0;
+    auto it = aircraftFlightSeconds.find(aircraftId);
+    return (it != aircraftFlightSeconds.end()) ? static_cast<double>(it->second.back()) / 3600.0 : 0.0;
+}
+
+// Получить время полётов в диапазоне (O(log n) по накопленным суммам)
+double Schedule::getTotalFlightTimeInRange(const std::string& aircraftId, std::time_t startTime, std::time_t endTime) const {
+    return static_cast<double>(flightSecondsInRange(aircraftId, startTime, endTime)) / 3600.0;
+}
+
+// Налёт самолёта за последние 24 часа, 7 и 28 суток до момента now
+AircraftFlightHours Schedule::getRollingFlightHours(const std::string& aircraftId, std::time_t now) const {
+    AircraftFlightHours hours;
+    hours.aircraftId = aircraftId;
+    hours.last24Hours = static_cast<double>(flightSecondsInRange(aircraftId, now - DAY_SECONDS, now)) / 3600.0;
+    hours.last7Days = static_cast<double>(flightSecondsInRange(aircraftId, now - 7 * DAY_SECONDS, now)) / 3600.0;
+    hours.last28Days = static_cast<double>(flightSecondsInRange(aircraftId, now - 28 * DAY_SECONDS, now)) / 3600.0;
+    return hours;
+}
+
+// Скользящий налёт всего парка за один проход по самолётам (упорядочено по бортовому номеру)
+std::vector<AircraftFlightHours> Schedule::getFleetRollingFlightHours(std::time_t now) const {
+    std::vector<AircraftFlightHours> fleet;
+    fleet.reserve(aircraftFlights.size());
+    for (const auto& aircraft : aircraftFlights) {
+        fleet.push_back(getRollingFlightHours(aircraft.first, now));
+    }
+    std::sort(fleet.begin(), fleet.end(),
+        [](const AircraftFlightHours& a, const AircraftFlightHours& b) { return a.aircraftId < b.aircraftId; });
+    return fleet;
+}
+
+// Список рейсов самолёта без копирования
+const Schedule::FlightList& Schedule::getFlightsByAircraftRef(const std::string& aircraftId) const {
+    static const FlightList empty;
+    auto it = aircraftFlights.find(aircraftId);
+    return (it != aircraftFlights.end()) ? it->second : empty;
+}
+
+// Получить список перегруженных самолётов (более 12 часов налёта в одни местные сутки)
+// Набор поддерживается при каждом изменении расписания: O(число перегруженных).
+std::vector<std::string> Schedule::getOverworkedAircraft() const {
+    return std::vector<std::string>(overworkedAircraft.begin(), overworkedAircraft.end());
+}
+
+// Превышен ли лимит суточного налёта самолёта хотя бы в одни сутки
+bool Schedule::isOverworked(const std::string& aircraftId) const {
+    return overworkedAircraft.count(aircraftId) != 0;
+}
+
+// Пересчитать суточный налёт заново
+// Набор перегруженных самолётов поддерживается при каждом изменении; полный пересчёт
+// нужен, если время рейсов менялось в обход расписания. Уведомления — как при пересборке.
+void Schedule::recalculateOverwork() {
+    rebuildDuty();
+}
+
+// Налёт самолёта за местные сутки, содержащие момент time
+double Schedule::getDailyFlightHours(const std::string& aircraftId, std::time_t time) const {
+    auto duty = aircraftDuty.find(aircraftId);
+    if (duty == aircraftDuty.end()) {
+        return 0.0;
+    }
+    auto day = duty->second.daySeconds.find(localTime.getLocalDay(time));
+    return (day != duty->second.daySeconds.end()) ? static_cast<double>(day->second) / 3600.0 : 0.0;
+}
+
+// Установить уведомление об изменении набора перегруженных самолётов
+void Schedule::setOverworkCallback(OverworkCallback callback) {
+    overworkCallback = callback;
+}
+
+// Учесть рейс в суточном налёте самолёта (sign = +1 при добавлении, -1 при удалении)
+// Рейс делится на части по местным полуночам; уведомление отправляется, когда
+// у самолёта появляются первые сутки сверх лимита или исчезают последние.
+void Schedule::updateDuty(const Flight& flight, int sign) {
+    std::time_t departure = flight.getDepartureTime();
+    std::time_t arrival = flight.getArrivalTime();
+    if (arrival <= departure) {
+        return;
+    }
+    localTime.cover(departure, arrival);
     
-    for (const auto& flight : flights) {
-        if (flight && flight->getAircraftId() == aircraftId) {
-            totalTime += flight->getFlightDurationHours();
+    const std::string aircraftId = flight.getAircraftId();
+    DutyDays& duty = aircraftDuty[aircraftId];
+    bool wasOverworked = duty.overworkedDays > 0;
+    for (std::time_t start = departure; start < arrival; ) {
+        std::time_t end = std::min(arrival, localTime.getNextLocalMidnight(start));
+        long long day = localTime.getLocalDay(start);
+        long long& seconds = duty.daySeconds[day];
+        bool wasOver = seconds > MAX_DAILY_FLIGHT_TIME;
+        seconds += sign * static_cast<long long>(end - start);
+        bool isOver = seconds > MAX_DAILY_FLIGHT_TIME;
+        duty.overworkedDays += (isOver ? 1 : 0) - (wasOver ? 1 : 0);
+        if (seconds <= 0) {
+            duty.daySeconds.erase(day);
         }
+        start = end;
     }
     
-    return totalTime;
+    bool nowOverworked = duty.overworkedDays > 0;
+    if (duty.daySeconds.empty()) {
+        aircraftDuty.erase(aircraftId);
+    }
+    if (nowOverworked != wasOverworked) {
+        if (nowOverworked) {
+            overworkedAircraft.insert(aircraftId);
+        } else {
+            overworkedAircraft.erase(aircraftId);
+        }
+        if (overworkCallback) {
+            overworkCallback(aircraftId, nowOverworked);
+        }
+    }
 }
 
-// Получить время полётов в диапазоне
-double Schedule::getTotalFlightTimeInRange(const std::string& aircraftId, std::time_t startTime, std::time_t endTime) const {
-    double totalTime = 0.0;
-    
-    for (const auto& flight : flights) {
-        if (flight && flight->getAircraftId() == aircraftId &&
-            flight->getDepartureTime() >= startTime && 
-            flight->getDepartureTime() <= endTime) {
-            totalTime += flight->getFlightDurationHours();
+// Суточный налёт одного самолёта по его упорядоченному списку рейсов
+// Части рейсов складываются в плоский буфер (сутки идут по порядку, если рейсы
+// самолёта не перекрываются), затем переносятся в таблицу суток.
+void Schedule::accumulateDuty(const FlightList& aircraftFlights, const LocalTimeCache& calendar,
+                              std::vector<std::pair<long long, long long>>& buffer, DutyDays& duty) {
+    buffer.clear();
+    for (const auto& flight : aircraftFlights) {
+        std::time_t arrival = flight->getArrivalTime();
+        for (std::time_t start = flight->getDepartureTime(); start < arrival; ) {
+            std::time_t end = std::min(arrival, calendar.getNextLocalMidnight(start));
+            long long day = calendar.getLocalDay(start);
+            if (!buffer.empty() && buffer.back().first == day) {
+                buffer.back().second += end - start;
+            } else {
+                buffer.emplace_back(day, end - start);
+            }
+            start = end;
         }
     }
     
-    return totalTime;
+    duty.daySeconds.clear();
+    duty.daySeconds.reserve(buffer.size());
+    for (const auto& part : buffer) {
+        duty.daySeconds[part.first] += part.second;
+    }
+    duty.overworkedDays = 0;
+    for (const auto& day : duty.daySeconds) {
+        if (day.second > MAX_DAILY_FLIGHT_TIME) {
+            ++duty.overworkedDays;
+        }
+    }
 }
 
-// Получить список перегруженных самолётов
-std::vector<std::string> Schedule::getOverworkedAircraft() const {
-    std::vector<std::string> overworkedAircraft;
-    const double MAX_DAILY_FLIGHT_TIME = 12.0; // Максимум 12 часов в день
-    
-    // Группируем рейсы по самолётам и дням
-    std::map<std::string, std::map<std::string, double> > aircraftDailyTime;
+// Пересчитать суточный налёт всех самолётов (самолёты обрабатываются параллельно)
+// Уведомления отправляются для самолётов, чьё состояние изменилось.
+void Schedule::rebuildDuty() {
+    std::set<std::string> previous;
+    previous.swap(overworkedAircraft);
+    aircraftDuty.clear();
     
-    for (const auto& flight : flights) {
-        if (!flight) continue;
+    if (!flights.empty()) {
+        // Кэш местного времени заполняется заранее (с запасом на прилёт последних рейсов),
+        // чтобы потоки только читали его; моменты вне кэша вычисляются напрямую.
+        // Крайний процент рейсов с каждой стороны не учитывается: одиночный выброс
+        // по времени не растягивает кэш на годы
+        size_t trimmed = flights.size() / 100;
+        localTime.cover(flights[trimmed]->getDepartureTime(),
+                        flights[flights.size() - 1 - trimmed]->getDepartureTime() + 2 * DAY_SECONDS);
         
-        std::string aircraftId = flight->getAircraftId();
-        std::time_t depTime = flight->getDepartureTime();
+        // Записи самолётов создаются до запуска потоков: каждый поток заполняет только свои
+        std::vector<std::pair<const FlightList*, DutyDays*>> work;
+        work.reserve(aircraftFlights.size());
+        aircraftDuty.reserve(aircraftFlights.size());
+        for (const auto& aircraft : aircraftFlights) {
+            work.emplace_back(&aircraft.second, &aircraftDuty[aircraft.first]);
+        }
         
-        // Получаем дату (без времени)
-        std::tm tm;
-        localtime_s(&tm, &depTime);
-        std::string date = std::to_string(tm.tm_year + 1900) + "-" + 
-                          std::to_string(tm.tm_mon + 1) + "-" + 
-                          std::to_string(tm.tm_mday);
+        parallelRanges(work.size(), flights.size(), [&](size_t begin, size_t end) {
+            std::vector<std::pair<long long, long long>> buffer;
+            for (size_t i = begin; i < end; ++i) {
+                accumulateDuty(*work[i].first, localTime, buffer, *work[i].second);
+            }
+        });
         
-        aircraftDailyTime[aircraftId][date] += flight->getFlightDurationHours();
+        for (const auto& duty : aircraftDuty) {
+            if (duty.second.overworkedDays > 0) {
+                overworkedAircraft.insert(duty.first);
+            }
+        }
     }
     
-    // Проверяем, какие самолёты перегружены
-    for (const auto& aircraft : aircraftDailyTime) {
-        for (const auto& day : aircraft.second) {
-            if (day.second > MAX_DAILY_FLIGHT_TIME) {
-                overworkedAircraft.push_back(aircraft.first);
-                break;
+    if (overworkCallback) {
+        for (const auto& aircraftId : previous) {
+            if (overworkedAircraft.count(aircraftId) == 0) {
+                overworkCallback(aircraftId, false);
+            }
+        }
+        for (const auto& aircraftId : overworkedAircraft) {
+            if (previous.count(aircraftId) == 0) {
+                overworkCallback(aircraftId, true);
             }
         }
     }
-    
-    return overworkedAircraft;
 }
 
 // Получить строковое представление всего расписания
+// Момент читается один раз: статусы всех рейсов отчёта согласованы
 std::string Schedule::toString() const {
+    const std::time_t now = clock->now();
     std::ostringstream oss;
     oss << "Flight Schedule (" << flights.size() << " flights):" << std::endl;
     oss << "==========================================" << std::endl;
     
     for (const auto& flight : flights) {
         if (flight) {
-            oss << flight->toString() << std::endl;
+            oss << flight->toString(now) << std::endl;
         }
     }
     
@@ -256,18 +1212,19 @@ std::string Schedule::toString() const {
 
 // Получить расписание для самолёта
 std::string Schedule::getScheduleForAircraft(const std::string& aircraftId) const {
+    const std::time_t now = clock->now();
     std::ostringstream oss;
     oss << "Schedule for Aircraft " << aircraftId << ":" << std::endl;
     oss << "==========================================" << std::endl;
     
-    auto aircraftFlights = getFlightsByAircraft(aircraftId);
-    for (const auto& flight : aircraftFlights) {
+    const auto& flightsOfAircraft = getFlightsByAircraftRef(aircraftId);
+    for (const auto& flight : flightsOfAircraft) {
         if (flight) {
-            oss << flight->toString() << std::endl;
+            oss << flight->toString(now) << std::endl;
         }
     }
     
-    if (aircraftFlights.empty()) {
+    if (flightsOfAircraft.empty()) {
         oss << "No flights scheduled for this aircraft." << std::endl;
     }
     
@@ -276,6 +1233,7 @@ std::string Schedule::getScheduleForAircraft(const std::string& aircraftId) cons
 
 // Получить расписание самолёта в диапазоне
 std::string Schedule::getScheduleForAircraftInRange(const std::string& aircraftId, std::time_t startTime, std::time_t endTime) const {
+    const std::time_t now = clock->now();
     std::ostringstream oss;
     char startTimeStr[100];
     char endTimeStr[100];
@@ -284,11 +1242,8 @@ std::string Schedule::getScheduleForAircraftInRange(const std::string& aircraftI
     oss << "Schedule for Aircraft " << aircraftId << " (" << startTimeStr << " - " << endTimeStr << "):" << std::endl;
     oss << "==========================================" << std::endl;
     
-    auto aircraftFlights = getFlightsByAircraft(aircraftId);
-    for (const auto& flight : aircraftFlights) {
-        if (flight && flight->getDepartureTime() >= startTime && flight->getDepartureTime() <= endTime) {
-            oss << flight->toString() << std::endl;
-        }
+    for (const auto& flight : aircraftFlightsInRange(aircraftId, startTime, endTime)) {
+        oss << flight->toString(now) << std::endl;
     }
     
     return oss.str();
@@ -297,37 +1252,220 @@ std::string Schedule::getScheduleForAircraftInRange(const std::string& aircraftI
 // Получить отчёт о просроченных срочных грузах
 std::string Schedule::getOverdueUrgentCargoReport() const {
     std::ostringstream oss;
+    const std::time_t now = clock->now();
     oss << "Overdue Urgent Cargo Report:" << std::endl;
     oss << "=============================" << std::endl;
     
-    oss << "No overdue urgent cargo found." << std::endl;
+    auto overdue = cargoDeadlines->getOverdue(now);
+    for (const auto& entry : overdue) {
+        oss << "[" << entry.location << "] " << entry.cargo->toString(now) << std::endl;
+    }
+    
+    if (overdue.empty()) {
+        oss << "No overdue urgent cargo found." << std::endl;
+    } else {
+        oss << "Total overdue: " << overdue.size() << std::endl;
+    }
     
     return oss.str();
 }
 
+// Подключить грузы самолёта к индексу сроков
+void Schedule::registerAircraft(std::shared_ptr<Aircraft> aircraft) {
+    if (aircraft) {
+        aircraft->setDeadlineIndex(cargoDeadlines);
+    }
+}
+
+// Подключить грузы аэропорта к индексу сроков
+void Schedule::registerAirport(std::shared_ptr<Airport> airport) {
+    if (airport) {
+        airport->setDeadlineIndex(cargoDeadlines);
+    }
+}
+
+// Просроченные грузы сети на текущий момент часов расписания
+std::vector<CargoDeadlineEntry> Schedule::getOverdueUrgentCargo() const {
+    return cargoDeadlines->getOverdue(clock->now());
+}
+
+// Срочные грузы сети на текущий момент часов расписания
+std::vector<CargoDeadlineEntry> Schedule::getUrgentCargo() const {
+    return cargoDeadlines->getUrgent(clock->now());
+}
+
+// Получить индекс сроков грузов сети
+std::shared_ptr<CargoDeadlineIndex> Schedule::getCargoDeadlineIndex() const {
+    return cargoDeadlines;
+}
+
+// Создать движок событий при первом обращении
+// Часы движка начинают с момента start: таймеры ставятся только на будущие вылеты и прибытия
+EventEngine& Schedule::ensureEvents(std::time_t start) {
+    if (!events) {
+        events.reset(new EventEngine(start));
+        for (const auto& flight : flights) {
+            scheduleFlightEvents(flight);
+        }
+    }
+    return *events;
+}
+
+// Поставить таймеры вылета (now >= вылета) и прибытия (now > прибытия) рейса
+void Schedule::scheduleFlightEvents(const std::shared_ptr<Flight>& flight) {
+    if (!events || !flight || flight->isCompleted()) return;
+    EventEngine::TimerId departure = events->schedule(flight->getDepartureTime(),
+        ScheduleEvent{ScheduleEventType::FlightDeparted, flight->getDepartureTime(),
+                      flight->getFlightNumber(), flight->getDepartureAirport()});
+    EventEngine::TimerId arrival = events->schedule(flight->getArrivalTime() + 1,
+        ScheduleEvent{ScheduleEventType::FlightArrived, flight->getArrivalTime(),
+                      flight->getFlightNumber(), flight->getDestinationAirport()});
+    if (departure != 0 || arrival != 0) {
+        flightTimers[flight.get()] = std::make_pair(departure, arrival);
+    }
+}
+
+// Отменить таймеры рейса
+void Schedule::cancelFlightEvents(const Flight* flight) {
+    if (!events) return;
+    auto it = flightTimers.find(flight);
+    if (it != flightTimers.end()) {
+        events->cancel(it->second.first);
+        events->cancel(it->second.second);
+        flightTimers.erase(it);
+    }
+}
+
+// Добавить получателя пакетов событий
+void Schedule::addEventListener(EventEngine::EventCallback callback) {
+    ensureEvents(clock->now()).addListener(std::move(callback));
+}
+
+// Доставить наступившие события
+// Просрочка грузов берётся из индекса сроков диапазоном (прошлый момент движка, now]:
+// такие грузы ставятся в колесо перед продвижением и приходят в общем пакете по времени.
+size_t Schedule::processEvents() {
+    return processEvents(clock->now());
+}
+
+// Доставить события, наступившие к моменту now
+// При первом обращении движок создаётся с часами на now, поэтому прошедшие события не доставляются
+size_t Schedule::processEvents(std::time_t now) {
+    EventEngine& engine = ensureEvents(now);
+    for (const auto& entry : cargoDeadlines->getDueInRange(engine.getTime(), now)) {
+        engine.schedule(entry.cargo->getDeadline() + 1,
+            ScheduleEvent{ScheduleEventType::CargoOverdue, entry.cargo->getDeadline(),
+                          entry.cargo->getCargoNumber(), entry.location});
+    }
+    return engine.advanceTo(now);
+}
+
+// Получить движок событий
+EventEngine& Schedule::getEventEngine() {
+    return ensureEvents(clock->now());
+}
+
+// Получить движок событий, создав его с часами на start
+EventEngine& Schedule::getEventEngine(std::time_t start) {
+    return ensureEvents(start);
+}
+
 // Завершить рейс
 void Schedule::completeFlight(const std::string& flightNumber) {
     auto flight = findFlight(flightNumber);
     if (flight) {
+        // Рейс переходит в раздел завершённых
+        statusTracker.remove(flight.get());
         flight->completeFlight();
+        statusTracker.add(flight.get());
+        // Завершённый рейс больше не вылетает и не прибывает
+        cancelFlightEvents(flight.get());
+        recordChange(ScheduleChangeType::Completed, *flight);
     }
 }
 
-// Добавить обратные рейсы для всех прямых рейсов
-void Schedule::addReturnFlights() {
-    std::vector<std::shared_ptr<Flight>> returnFlights;
+// Обратные рейсы одного самолёта по его упорядоченному списку рейсов
+// При rejectConflicts обратный рейс отбрасывается, если пересекается с рейсом
+// самолёта или с уже принятым обратным рейсом. Рейс r пересекается с каким-либо
+// из рейсов, вылетевших раньше r.arrival, тогда и только тогда, когда максимальное
+// время прибытия среди них больше r.departure (префиксный максимум по списку).
+static void makeReturnFlights(const Schedule::FlightList& aircraftFlights, bool rejectConflicts,
+                              std::vector<std::shared_ptr<Flight>>& result) {
+    std::vector<std::shared_ptr<Flight>> returns;
+    for (const auto& flight : aircraftFlights) {
+        if (!flight->isCompleted()) {
+            returns.push_back(std::make_shared<Flight>(flight->createReturnFlight()));
+        }
+    }
+    std::stable_sort(returns.begin(), returns.end(), departsEarlier);
+    if (!rejectConflicts) {
+        result.insert(result.end(), returns.begin(), returns.end());
+        return;
+    }
     
-    for (const auto& flight : flights) {
-        if (flight && !flight->isCompleted()) {
-            Flight returnFlight = flight->createReturnFlight();
-            returnFlights.push_back(std::make_shared<Flight>(returnFlight));
+    std::vector<std::time_t> prefixMaxArrival(aircraftFlights.size());
+    for (size_t i = 0; i < aircraftFlights.size(); ++i) {
+        std::time_t arrival = aircraftFlights[i]->getArrivalTime();
+        prefixMaxArrival[i] = (i > 0) ? std::max(prefixMaxArrival[i - 1], arrival) : arrival;
+    }
+    bool accepted = false;
+    std::time_t acceptedMaxArrival = 0;  // Принятые обратные рейсы вылетают не позже текущего
+    for (const auto& returnFlight : returns) {
+        std::time_t departure = returnFlight->getDepartureTime();
+        std::time_t arrival = returnFlight->getArrivalTime();
+        auto bound = std::lower_bound(aircraftFlights.begin(), aircraftFlights.end(), arrival, DepartureOrder());
+        size_t before = static_cast<size_t>(bound - aircraftFlights.begin());
+        if (before > 0 && prefixMaxArrival[before - 1] > departure) {
+            continue;  // Пересечение с рейсом самолёта
         }
+        if (accepted && acceptedMaxArrival > departure) {
+            continue;  // Пересечение с ранее принятым обратным рейсом
+        }
+        acceptedMaxArrival = accepted ? std::max(acceptedMaxArrival, arrival) : arrival;
+        accepted = true;
+        result.push_back(returnFlight);
+    }
+}
+
+// Добавить обратные рейсы для всех незавершённых рейсов
+// Обратные рейсы строятся параллельно по самолётам в отдельный буфер и
+// добавляются одним слиянием (addFlights). Возвращает число добавленных рейсов.
+int Schedule::addReturnFlights(bool rejectConflicts) {
+    // Самолёты упорядочиваются по бортовому номеру, чтобы порядок рейсов
+    // с одинаковым временем вылета не зависел от хеш-таблицы
+    std::vector<const std::pair<const std::string, FlightList>*> aircraftLists;
+    aircraftLists.reserve(aircraftFlights.size());
+    for (const auto& aircraft : aircraftFlights) {
+        aircraftLists.push_back(&aircraft);
     }
+    std::sort(aircraftLists.begin(), aircraftLists.end(),
+        [](const std::pair<const std::string, FlightList>* a, const std::pair<const std::string, FlightList>* b) {
+            return a->first < b->first;
+        });
     
-    // Добавляем обратные рейсы
-    for (const auto& returnFlight : returnFlights) {
-        addFlight(returnFlight);
+    std::vector<std::vector<std::shared_ptr<Flight>>> perAircraft(aircraftLists.size());
+    parallelRanges(aircraftLists.size(), flights.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            makeReturnFlights(aircraftLists[i]->second, rejectConflicts, perAircraft[i]);
+        }
+    });
+    
+    std::vector<std::shared_ptr<Flight>> returnFlights;
+    returnFlights.reserve(flights.size());
+    for (const auto& returns : perAircraft) {
+        returnFlights.insert(returnFlights.end(), returns.begin(), returns.end());
     }
+    return addFlights(returnFlights);
+}
+
+// Установить источник времени
+void Schedule::setClock(std::shared_ptr<const Clock> newClock) {
+    clock = newClock ? newClock : std::make_shared<SystemClock>();
+}
+
+// Получить источник времени
+std::shared_ptr<const Clock> Schedule::getClock() const {
+    return clock;
 }
 
 // Получить общее количество рейсов
@@ -335,35 +1473,23 @@ int Schedule::getTotalFlights() const {
     return static_cast<int>(flights.size());
 }
 
-// Получить количество завершённых рейсов
+// Получить количество завершённых рейсов (O(1))
 int Schedule::getCompletedFlights() const {
-    int count = 0;
-    for (const auto& flight : flights) {
-        if (flight && flight->isCompleted()) {
-            count++;
-        }
-    }
-    return count;
+    return statusTracker.getCompletedCount();
 }
 
 // Получить количество запланированных рейсов
+// Часы трекера продвигаются до текущего момента: перебираются только сменившие статус рейсы.
+// Метод константный и вызывается параллельными читателями, поэтому продвижение под statusMutex
 int Schedule::getScheduledFlights() const {
-    int count = 0;
-    for (const auto& flight : flights) {
-        if (flight && flight->isScheduled()) {
-            count++;
-        }
-    }
-    return count;
+    std::lock_guard<std::mutex> lock(statusMutex);
+    statusTracker.advanceTo(clock->now());
+    return statusTracker.getScheduledCount();
 }
 
 // Получить количество рейсов в процессе
 int Schedule::getInProgressFlights() const {
-    int count = 0;
-    for (const auto& flight : flights) {
-        if (flight && flight->isInProgress()) {
-            count++;
-        }
-    }
-    return count;
+    std::lock_guard<std::mutex> lock(statusMutex);
+    statusTracker.advanceTo(clock->now());
+    return statusTracker.getInProgressCount();
 }
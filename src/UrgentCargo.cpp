@@ -49,26 +49,38 @@ void UrgentCargo::setDeadline(std::time_t deadline) {
 
 // Проверить, просрочен ли груз
 bool UrgentCargo::isOverdue() const {
+    return isOverdue(std::time(nullptr));
+}
+
+// Проверить, просрочен ли груз на момент now
+bool UrgentCargo::isOverdue(std::time_t now) const {
     if (deadline == 0) return false;  // Если крайний срок не установлен
     
-    std::time_t now = std::time(nullptr);
     return now > deadline;
 }
 
 // Проверить, является ли груз срочным
 bool UrgentCargo::isUrgent() const {
+    return isUrgent(std::time(nullptr));
+}
+
+// Проверить, является ли груз срочным на момент now
+bool UrgentCargo::isUrgent(std::time_t now) const {
     if (deadline == 0) return false;
     
-    std::time_t now = std::time(nullptr);
     // Считаем груз срочным, если до крайнего срока осталось менее 24 часов
     return (deadline - now) < 24 * 60 * 60;
 }
 
 // Получить количество дней до крайнего срока
 int UrgentCargo::getDaysUntilDeadline() const {
+    return getDaysUntilDeadline(std::time(nullptr));
+}
+
+// Получить количество дней до крайнего срока от момента now
+int UrgentCargo::getDaysUntilDeadline(std::time_t now) const {
     if (deadline == 0) return -1;  // Если крайний срок не установлен
     
-    std::time_t now = std::time(nullptr);
     std::time_t diff = deadline - now;
     
     if (diff < 0) return 0;  // Уже просрочен
@@ -78,6 +90,11 @@ int UrgentCargo::getDaysUntilDeadline() const {
 
 // Переопределение метода toString
 std::string UrgentCargo::toString() const {
+    return toString(std::time(nullptr));
+}
+
+// Строковое представление с признаками срочности на момент now
+std::string UrgentCargo::toString(std::time_t now) const {
     std::ostringstream oss;
     oss << "URGENT " << Cargo::toString();  // Добавляем префикс "URGENT"
     
@@ -88,9 +105,9 @@ std::string UrgentCargo::toString() const {
         std::strftime(timeStr, sizeof(timeStr), "%Y-%m-%d %H:%M:%S", &tmStruct);
         oss << " [Deadline: " << timeStr << "]";
         
-        if (isOverdue()) {
+        if (isOverdue(now)) {
             oss << " [OVERDUE!]";
-        } else if (isUrgent()) {
+        } else if (isUrgent(now)) {
             oss << " [URGENT!]";
         }
     }
@@ -100,6 +117,11 @@ std::string UrgentCargo::toString() const {
 
 // Переопределение метода isValid
 bool UrgentCargo::isValid() const {
+    return isValid(std::time(nullptr));
+}
+
+// Проверить корректность на момент now
+bool UrgentCargo::isValid(std::time_t now) const {
     // Сначала проверяем базовую валидность
     if (!Cargo::isValid()) {
         return false;
@@ -111,7 +133,6 @@ bool UrgentCargo::isValid() const {
     }
     
     // Крайний срок должен быть в будущем (при создании)
-    std::time_t now = std::time(nullptr);
     if (deadline <= now) {
         return false;
     }
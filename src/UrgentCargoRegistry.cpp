@@ -0,0 +1,128 @@
+#include "UrgentCargoRegistry.h"
+#include <algorithm>
+#include <utility>
+
+// Создать пустой реестр
+UrgentCargoRegistry::UrgentCargoRegistry(const std::string& location) : location(location) {
+}
+
+// Конструктор копирования: записи общего индекса принадлежат исходному реестру
+UrgentCargoRegistry::UrgentCargoRegistry(const UrgentCargoRegistry& other)
+    : location(other.location), cargoList(other.cargoList), deadlines(other.deadlines) {
+}
+
+// Оператор присваивания: записи в подключённом общем индексе заменяются грузами other
+UrgentCargoRegistry& UrgentCargoRegistry::operator=(const UrgentCargoRegistry& other) {
+    if (this != &other) {
+        detach();
+        location = other.location;
+        cargoList = other.cargoList;
+        deadlines = other.deadlines;
+        attach();
+    }
+    return *this;
+}
+
+// Деструктор: записи в общем индексе ссылаются на реестр как на владельца
+UrgentCargoRegistry::~UrgentCargoRegistry() {
+    detach();
+}
+
+// Учесть груз в списке, локальном и общем индексах сроков
+void UrgentCargoRegistry::add(std::shared_ptr<UrgentCargo> cargo) {
+    deadlines.add(cargo);
+    if (network) {
+        network->add(cargo, this, location);
+    }
+    cargoList.push_back(std::move(cargo));
+}
+
+// Убрать грузы с данным номером из списка и индексов
+// stable_partition, а не remove_if: хвост после remove_if не обязан содержать удаляемые грузы
+void UrgentCargoRegistry::remove(const std::string& cargoNumber) {
+    auto removed = std::stable_partition(cargoList.begin(), cargoList.end(),
+        [&cargoNumber](const std::shared_ptr<UrgentCargo>& cargo) {
+            return !cargo || cargo->getCargoNumber() != cargoNumber;
+        });
+    for (auto it = removed; it != cargoList.end(); ++it) {
+        deadlines.remove(it->get());
+        if (network) {
+            network->remove(it->get(), this);
+        }
+    }
+    cargoList.erase(removed, cargoList.end());
+}
+
+// Убрать все грузы
+void UrgentCargoRegistry::clear() {
+    detach();
+    cargoList.clear();
+    deadlines.clear();
+}
+
+// Найти груз по номеру
+std::shared_ptr<UrgentCargo> UrgentCargoRegistry::find(const std::string& cargoNumber) const {
+    auto it = std::find_if(cargoList.begin(), cargoList.end(),
+        [&cargoNumber](const std::shared_ptr<UrgentCargo>& cargo) {
+            return cargo && cargo->getCargoNumber() == cargoNumber;
+        });
+    return (it != cargoList.end()) ? *it : nullptr;
+}
+
+// Грузы в порядке добавления
+const std::vector<std::shared_ptr<UrgentCargo>>& UrgentCargoRegistry::getList() const {
+    return cargoList;
+}
+
+// Просроченные на момент now (префикс индекса сроков, в порядке сроков)
+std::vector<std::shared_ptr<UrgentCargo>> UrgentCargoRegistry::getOverdue(std::time_t now) const {
+    std::vector<std::shared_ptr<UrgentCargo>> overdueCargo;
+    for (const auto& entry : deadlines.getOverdue(now)) {
+        overdueCargo.push_back(entry.cargo);
+    }
+    return overdueCargo;
+}
+
+// Срочные на момент now (префикс индекса сроков, в порядке сроков)
+std::vector<std::shared_ptr<UrgentCargo>> UrgentCargoRegistry::getUrgent(std::time_t now) const {
+    std::vector<std::shared_ptr<UrgentCargo>> urgentCargo;
+    for (const auto& entry : deadlines.getUrgent(now)) {
+        urgentCargo.push_back(entry.cargo);
+    }
+    return urgentCargo;
+}
+
+// Сменить местонахождение: оно хранится в каждой записи общего индекса
+void UrgentCargoRegistry::setLocation(const std::string& newLocation) {
+    detach();
+    location = newLocation;
+    attach();
+}
+
+// Подключить общий индекс сроков сети
+void UrgentCargoRegistry::setNetworkIndex(std::shared_ptr<CargoDeadlineIndex> index) {
+    detach();
+    network = std::move(index);
+    attach();
+}
+
+// Получить подключённый общий индекс
+std::shared_ptr<CargoDeadlineIndex> UrgentCargoRegistry::getNetworkIndex() const {
+    return network;
+}
+
+// Внести все грузы в общий индекс
+void UrgentCargoRegistry::attach() {
+    if (!network) return;
+    for (const auto& cargo : cargoList) {
+        network->add(cargo, this, location);
+    }
+}
+
+// Убрать все грузы из общего индекса
+void UrgentCargoRegistry::detach() {
+    if (!network) return;
+    for (const auto& cargo : cargoList) {
+        network->remove(cargo.get(), this);
+    }
+}
@@ -5,6 +5,7 @@
 // Объявляем функции тестирования
 int testCargoMain();
 int testHierarchyMain();
+int testScheduleMain();
 
 int main() {
     SetConsoleOutputCP(CP_UTF8);
@@ -26,12 +27,17 @@ int main() {
     std::cout << "===============================" << std::endl;
     bool hierarchyTestsPassed = testHierarchyMain() == 0;
     
+    std::cout << std::endl;
+    std::cout << "ЗАПУСК ТЕСТОВ АЛГОРИТМОВ РАСПИСАНИЯ" << std::endl;
+    std::cout << "===================================" << std::endl;
+    bool scheduleTestsPassed = testScheduleMain() == 0;
+    
     std::cout << std::endl;
     std::cout << "=====================================================" << std::endl;
     std::cout << "                    ИТОГОВЫЙ РЕЗУЛЬТАТ" << std::endl;
     std::cout << "=====================================================" << std::endl;
     
-    if (cargoTestsPassed && hierarchyTestsPassed) {
+    if (cargoTestsPassed && hierarchyTestsPassed && scheduleTestsPassed) {
         std::cout << "✅ ВСЕ ТЕСТЫ ПРОЙДЕНЫ УСПЕШНО!" << std::endl;
         std::cout << "✅ Иерархия классов готова к использованию!" << std::endl;
         return 0;
@@ -43,6 +49,9 @@ int main() {
         if (!hierarchyTestsPassed) {
             std::cout << "❌ Тесты иерархии классов провалены" << std::endl;
         }
+        if (!scheduleTestsPassed) {
+            std::cout << "❌ Тесты алгоритмов расписания провалены" << std::endl;
+        }
         return 1;
     }
 }
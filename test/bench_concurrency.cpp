@@ -0,0 +1,154 @@
+#include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include "Flight.h"
+#include "Schedule.h"
+#include "ConcurrentSchedule.h"
+
+/**
+ * @brief Замеры многопоточного доступа к расписанию
+ *
+ * Читатели в нескольких потоках ищут рейс по номеру и выбирают рейсы за час,
+ * пока поток-писатель без перерыва добавляет пачки рейсов. Сравниваются
+ * ConcurrentSchedule (std::shared_mutex, читатели не ждут друг друга) и прежняя
+ * схема сервиса: Schedule за одним общим std::mutex. Отдельный замер в
+ * bench_schedule не используется: там замещён operator new для подсчёта
+ * выделений, а его счётчики не рассчитаны на несколько потоков.
+ */
+
+using BenchClock = std::chrono::steady_clock;
+
+static const std::time_t BASE_TIME = 1700000000;
+static const int PRELOADED_FLIGHTS = 200000;
+static const int AIRCRAFT_COUNT = 2000;
+static const int WRITER_BATCH = 100;
+static const std::chrono::milliseconds RUN_TIME(500);
+
+// Прежняя схема: все вызовы за одним мьютексом, результаты — копии (как у ConcurrentSchedule)
+class MutexSchedule {
+private:
+    mutable std::mutex mutex;
+    Schedule schedule;
+
+public:
+    int addFlights(const std::vector<std::shared_ptr<Flight>>& newFlights) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return schedule.addFlights(newFlights);
+    }
+
+    std::shared_ptr<Flight> findFlight(const std::string& flightNumber) const {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto flight = schedule.findFlight(flightNumber);
+        return flight ? std::make_shared<Flight>(*flight) : nullptr;
+    }
+
+    std::vector<std::shared_ptr<Flight>> getFlightsInTimeRange(std::time_t startTime, std::time_t endTime) const {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<std::shared_ptr<Flight>> result;
+        for (const auto& flight : schedule.getFlightsInTimeRange(startTime, endTime)) {
+            result.push_back(std::make_shared<Flight>(*flight));
+        }
+        return result;
+    }
+};
+
+// Рейсы на год: у каждого самолёта рейсы идут друг за другом
+static std::vector<std::shared_ptr<Flight>> makeFlights(int flightCount, const std::string& prefix,
+                                                        const std::string& aircraftPrefix, std::time_t start) {
+    std::vector<std::shared_ptr<Flight>> result;
+    result.reserve(flightCount);
+    for (int i = 0; i < flightCount; ++i) {
+        int aircraft = i % AIRCRAFT_COUNT;
+        std::time_t departure = start + static_cast<std::time_t>(i / AIRCRAFT_COUNT) * 4 * 3600;
+        result.push_back(std::make_shared<Flight>(prefix + std::to_string(i), "SVO", "LED",
+                                                  departure, departure + 3600,
+                                                  aircraftPrefix + std::to_string(aircraft)));
+    }
+    return result;
+}
+
+//! Итог одного прогона.
+struct RunResult {
+    double readsPerSecond;    ///< Чтений в секунду по всем читателям
+    double insertsPerSecond;  ///< Добавленных рейсов в секунду
+};
+
+// Читатели и писатель работают RUN_TIME; чтение — поиск по номеру и выборка за час
+template <class Target>
+static RunResult run(Target& target, int readerCount) {
+    std::atomic<bool> running(true);
+    std::atomic<long long> reads(0);
+    std::atomic<long long> inserted(0);
+    static int round = 0;
+    std::string writerPrefix = "N" + std::to_string(round++) + "-";
+
+    std::thread writer([&]() {
+        // Новые самолёты на тот же год: пачки попадают в середину общего списка
+        int batch = 0;
+        while (running) {
+            std::string batchPrefix = writerPrefix + std::to_string(batch) + "-";
+            auto flights = makeFlights(WRITER_BATCH, batchPrefix, batchPrefix, BASE_TIME + (batch % 1000) * 60);
+            ++batch;
+            inserted += target.addFlights(flights);
+        }
+    });
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < readerCount; ++r) {
+        readers.emplace_back([&, r]() {
+            std::mt19937 rng(r + 1);
+            long long local = 0;
+            while (running) {
+                int index = static_cast<int>(rng() % PRELOADED_FLIGHTS);
+                auto flight = target.findFlight("F" + std::to_string(index));
+                std::time_t from = BASE_TIME + static_cast<std::time_t>(rng() % (365 * 24)) * 3600;
+                auto flights = target.getFlightsInTimeRange(from, from + 3600);
+                local += (flight ? 1 : 0) + (flights.empty() ? 0 : 1);
+            }
+            reads += local;
+        });
+    }
+
+    auto start = BenchClock::now();
+    std::this_thread::sleep_for(RUN_TIME);
+    running = false;
+    writer.join();
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    double seconds = std::chrono::duration<double>(BenchClock::now() - start).count();
+    return RunResult{reads / seconds, inserted / seconds};
+}
+
+int main() {
+    std::cout << "Чтение во время вставки: shared_mutex против общего mutex" << std::endl;
+    std::cout << "(" << PRELOADED_FLIGHTS << " рейсов заранее, писатель добавляет пачки по " << WRITER_BATCH
+              << ", ядер: " << std::thread::hardware_concurrency() << ")" << std::endl;
+    std::cout << std::setw(8) << "readers" << std::setw(20) << "shared, reads/s" << std::setw(18) << "mutex, reads/s"
+              << std::setw(20) << "shared, inserts/s" << std::setw(18) << "mutex, inserts/s" << std::endl;
+
+    unsigned maxReaders = std::max(4u, std::thread::hardware_concurrency());
+    for (unsigned readers = 1; readers <= maxReaders; readers *= 2) {
+        ConcurrentSchedule concurrent;
+        MutexSchedule locked;
+        concurrent.addFlights(makeFlights(PRELOADED_FLIGHTS, "F", "A", BASE_TIME));
+        locked.addFlights(makeFlights(PRELOADED_FLIGHTS, "F", "A", BASE_TIME));
+
+        RunResult shared = run(concurrent, static_cast<int>(readers));
+        RunResult exclusive = run(locked, static_cast<int>(readers));
+        std::cout << std::setw(8) << readers << std::fixed << std::setprecision(0)
+                  << std::setw(20) << shared.readsPerSecond << std::setw(18) << exclusive.readsPerSecond
+                  << std::setw(20) << shared.insertsPerSecond << std::setw(18) << exclusive.insertsPerSecond << std::endl;
+    }
+    return 0;
+}
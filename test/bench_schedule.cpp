@@ -0,0 +1,700 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <ctime>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <map>
+#include <cstdlib>
+#include <new>
+
+#include "Flight.h"
+#include "Schedule.h"
+#include "DelayPropagator.h"
+#include "Aircraft.h"
+#include "FlightScheduleAPI.h"
+
+/**
+ * @brief Замеры производительности алгоритмов Schedule
+ *
+ * Сравнивает поиск конфликтов в Schedule::isValid() (sweep line по самолётам)
+ * с прежним попарным сравнением всех рейсов и измеряет время загрузки рейсов
+ * через addFlight (вставка по upper_bound) и addFlights (одно слияние),
+ * выборку рейсов за час из расписания на год (двоичный поиск против полного
+ * перебора) и поиск перегруженных самолётов (инкрементальный набор и полный
+ * пересчёт против localtime_s и строковых ключей), построение обратных рейсов
+ * одним слиянием и опрос счётчиков статусов (трекер против перебора).
+ */
+
+using BenchClock = std::chrono::steady_clock;
+
+// Счётчики выделений памяти (для сравнения аллокаций в C API)
+// Замещённые operator new/delete работают через malloc/free, о чём GCC предупреждает при встраивании
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+static std::size_t allocationCount = 0;
+static std::size_t allocatedBytes = 0;
+
+void* operator new(std::size_t size) {
+    ++allocationCount;
+    allocatedBytes += size;
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+static double elapsedMs(BenchClock::time_point start) {
+    return std::chrono::duration<double, std::milli>(BenchClock::now() - start).count();
+}
+
+// Прежний алгоритм: попарное сравнение всех рейсов, O(n^2)
+static bool nestedLoopHasConflicts(const std::vector<std::shared_ptr<Flight>>& flights) {
+    for (size_t i = 0; i < flights.size(); ++i) {
+        for (size_t j = i + 1; j < flights.size(); ++j) {
+            if (flights[i] && flights[j] && flights[i]->conflictsWith(*flights[j])) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Бесконфликтный набор рейсов: у каждого самолёта рейсы идут друг за другом
+static std::vector<std::shared_ptr<Flight>> makeFlights(int flightCount, int aircraftCount) {
+    std::mt19937 rng(7);
+    std::time_t base = 1700000000;
+    std::vector<std::time_t> nextFree(aircraftCount, base);
+    std::vector<std::shared_ptr<Flight>> result;
+    result.reserve(flightCount);
+    for (int i = 0; i < flightCount; ++i) {
+        int aircraft = i % aircraftCount;
+        std::time_t departure = nextFree[aircraft] + static_cast<std::time_t>(rng() % 4) * 900;
+        std::time_t arrival = departure + 3600 + static_cast<std::time_t>(rng() % 8) * 900;
+        nextFree[aircraft] = arrival;
+        result.push_back(std::make_shared<Flight>("F" + std::to_string(i), "SVO", "LED",
+                                                  departure, arrival, "A" + std::to_string(aircraft)));
+    }
+    // Перемешиваем, чтобы загрузка не шла в порядке вылета
+    std::shuffle(result.begin(), result.end(), rng);
+    return result;
+}
+
+static int benchConflicts() {
+    std::cout << "Поиск конфликтов: sweep line против попарного сравнения" << std::endl;
+    std::cout << std::setw(10) << "flights" << std::setw(16) << "sweep, ms"
+              << std::setw(18) << "nested loop, ms" << std::endl;
+    
+    const int sizes[] = {1000, 5000, 20000, 200000};
+    const int nestedLoopLimit = 20000;  // Дальше попарное сравнение занимает минуты
+    for (int size : sizes) {
+        Schedule schedule;
+        schedule.addFlights(makeFlights(size, size / 20));
+        
+        auto start = BenchClock::now();
+        bool sweepValid = schedule.isValid();
+        double sweepMs = elapsedMs(start);
+        
+        std::cout << std::setw(10) << size << std::setw(16) << std::fixed << std::setprecision(3) << sweepMs;
+        if (size <= nestedLoopLimit) {
+            start = BenchClock::now();
+            bool nestedConflicts = nestedLoopHasConflicts(schedule.getFlights());
+            double nestedMs = elapsedMs(start);
+            if (sweepValid == nestedConflicts) {
+                std::cerr << std::endl << "Результаты алгоритмов не совпадают!" << std::endl;
+                return 1;
+            }
+            std::cout << std::setw(18) << nestedMs;
+        } else {
+            std::cout << std::setw(18) << "-";
+        }
+        std::cout << std::endl;
+    }
+    return 0;
+}
+
+static void benchLoading() {
+    std::cout << std::endl << "Загрузка рейсов в расписание" << std::endl;
+    std::cout << std::setw(10) << "flights" << std::setw(18) << "addFlight, ms"
+              << std::setw(20) << "tryAddFlight, ms" << std::setw(18) << "addFlights, ms" << std::endl;
+    
+    const int sizes[] = {10000, 50000, 1000000};
+    const int singleInsertLimit = 50000;  // Поштучная вставка сдвигает хвост вектора
+    for (int size : sizes) {
+        auto batch = makeFlights(size, size / 20);
+        std::cout << std::setw(10) << size;
+        
+        if (size <= singleInsertLimit) {
+            Schedule schedule;
+            auto start = BenchClock::now();
+            for (const auto& flight : batch) {
+                schedule.addFlight(flight);
+            }
+            std::cout << std::setw(18) << std::fixed << std::setprecision(3) << elapsedMs(start);
+            
+            // Та же вставка с проверкой соседей по самолёту
+            Schedule checked;
+            start = BenchClock::now();
+            for (const auto& flight : batch) {
+                checked.tryAddFlight(flight);
+            }
+            std::cout << std::setw(20) << elapsedMs(start);
+        } else {
+            std::cout << std::setw(18) << "-" << std::setw(20) << "-";
+        }
+        
+        Schedule schedule;
+        auto start = BenchClock::now();
+        schedule.addFlights(batch);
+        std::cout << std::setw(18) << std::fixed << std::setprecision(3) << elapsedMs(start) << std::endl;
+    }
+}
+
+// Прежний алгоритм выборки по времени: перебор всех рейсов с копированием
+static size_t linearRangeCount(const Schedule& schedule, std::time_t startTime, std::time_t endTime) {
+    std::vector<std::shared_ptr<Flight>> rangeFlights;
+    for (const auto& flight : schedule.getFlights()) {
+        if (flight->getDepartureTime() >= startTime && flight->getDepartureTime() <= endTime) {
+            rangeFlights.push_back(flight);
+        }
+    }
+    return rangeFlights.size();
+}
+
+static int benchRangeQueries() {
+    std::cout << std::endl << "Рейсы за один час из расписания на год" << std::endl;
+    std::cout << std::setw(10) << "flights" << std::setw(20) << "lower_bound, us"
+              << std::setw(18) << "linear, us" << std::endl;
+    
+    const std::time_t base = 1700000000;
+    const std::time_t year = 365 * 24 * 3600;
+    const int queries = 1000;
+    const int linearQueries = 20;
+    const int sizes[] = {100000, 1000000};
+    for (int size : sizes) {
+        std::mt19937 rng(11);
+        std::vector<std::shared_ptr<Flight>> batch;
+        batch.reserve(size);
+        for (int i = 0; i < size; ++i) {
+            std::time_t departure = base + static_cast<std::time_t>(rng() % year);
+            batch.push_back(std::make_shared<Flight>("F" + std::to_string(i), "SVO", "LED",
+                                                     departure, departure + 3600, "A" + std::to_string(i % 1000)));
+        }
+        Schedule schedule;
+        schedule.addFlights(batch);
+        
+        std::vector<std::time_t> starts(queries);
+        for (auto& start : starts) {
+            start = base + static_cast<std::time_t>(rng() % (year - 3600));
+        }
+        
+        size_t found = 0;
+        auto start = BenchClock::now();
+        for (std::time_t from : starts) {
+            found += schedule.getFlightsInTimeRange(from, from + 3600).size();
+        }
+        double fastUs = elapsedMs(start) * 1000.0 / queries;
+        
+        size_t linearFound = 0;
+        start = BenchClock::now();
+        for (int q = 0; q < linearQueries; ++q) {
+            linearFound += linearRangeCount(schedule, starts[q], starts[q] + 3600);
+        }
+        double linearUs = elapsedMs(start) * 1000.0 / linearQueries;
+        
+        size_t expectedFound = 0;
+        for (int q = 0; q < linearQueries; ++q) {
+            expectedFound += schedule.getFlightsInTimeRange(starts[q], starts[q] + 3600).size();
+        }
+        if (expectedFound != linearFound) {
+            std::cout << "Расхождение результатов выборки!" << std::endl;
+            return 1;
+        }
+        std::cout << std::setw(10) << size << std::setw(20) << std::fixed << std::setprecision(3) << fastUs
+                  << std::setw(18) << linearUs << "   (" << found / queries << " рейсов в окне)" << std::endl;
+    }
+    return 0;
+}
+
+// Прежний алгоритм поиска перегруженных самолётов: localtime_s на каждый рейс,
+// строковый ключ даты, весь рейс относится к дню вылета
+static std::vector<std::string> legacyOverworkedAircraft(const Schedule& schedule) {
+    std::vector<std::string> overworkedAircraft;
+    std::map<std::string, std::map<std::string, double> > aircraftDailyTime;
+    for (const auto& flight : schedule.getFlights()) {
+        std::time_t depTime = flight->getDepartureTime();
+        std::tm tm;
+        localtime_s(&tm, &depTime);
+        std::string date = std::to_string(tm.tm_year + 1900) + "-" +
+                          std::to_string(tm.tm_mon + 1) + "-" +
+                          std::to_string(tm.tm_mday);
+        aircraftDailyTime[flight->getAircraftId()][date] += flight->getFlightDurationHours();
+    }
+    for (const auto& aircraft : aircraftDailyTime) {
+        for (const auto& day : aircraft.second) {
+            if (day.second > 12.0) {
+                overworkedAircraft.push_back(aircraft.first);
+                break;
+            }
+        }
+    }
+    return overworkedAircraft;
+}
+
+// Набор без перегрузок: у каждого самолёта рейс по 3 часа каждые 8 часов
+static std::vector<std::shared_ptr<Flight>> makeLightFlights(int flightCount, int aircraftCount) {
+    std::mt19937 rng(13);
+    std::time_t base = 1700000000;
+    std::vector<std::shared_ptr<Flight>> result;
+    result.reserve(flightCount);
+    for (int i = 0; i < flightCount; ++i) {
+        std::time_t departure = base + static_cast<std::time_t>(i / aircraftCount) * 8 * 3600 +
+                                static_cast<std::time_t>(rng() % 8) * 900;
+        result.push_back(std::make_shared<Flight>("L" + std::to_string(i), "SVO", "LED",
+                                                  departure, departure + 3 * 3600,
+                                                  "A" + std::to_string(i % aircraftCount)));
+    }
+    std::shuffle(result.begin(), result.end(), rng);
+    return result;
+}
+
+static void benchOverworked() {
+    std::cout << std::endl << "Поиск перегруженных самолётов" << std::endl;
+    std::cout << std::setw(10) << "flights" << std::setw(8) << "fleet" << std::setw(12) << "read, ms"
+              << std::setw(12) << "duty, ms" << std::setw(14) << "legacy, ms" << std::setw(12) << "speedup"
+              << std::setw(14) << "copy, ms" << std::endl;
+    
+    const int sizes[] = {100000, 1000000};
+    for (int size : sizes) {
+        for (int light = 0; light < 2; ++light) {
+            Schedule schedule;
+            schedule.addFlights(light ? makeLightFlights(size, size / 200) : makeFlights(size, size / 200));
+            
+            // Набор поддерживается инкрементально: чтение без пересчёта
+            auto start = BenchClock::now();
+            size_t overworked = schedule.getOverworkedAircraft().size();
+            double readMs = elapsedMs(start);
+            
+            // Только разбиение налёта по местным суткам (кэш часового пояса уже заполнен
+            // при загрузке) — та же работа, что у прежнего алгоритма
+            start = BenchClock::now();
+            schedule.recalculateOverwork();
+            double dutyMs = elapsedMs(start);
+            size_t recalculated = schedule.getOverworkedAircraft().size();
+            
+            start = BenchClock::now();
+            size_t legacyOverworked = legacyOverworkedAircraft(schedule).size();
+            double legacyMs = elapsedMs(start);
+            
+            // Полный пересчёт индексов и суточного налёта (копирование расписания)
+            start = BenchClock::now();
+            Schedule rebuilt(schedule);
+            double copyMs = elapsedMs(start);
+            
+            std::cout << std::setw(10) << size << std::setw(8) << (light ? "light" : "busy")
+                      << std::setw(12) << std::fixed << std::setprecision(3) << readMs
+                      << std::setw(12) << dutyMs << std::setw(14) << legacyMs
+                      << std::setw(11) << std::setprecision(1) << legacyMs / dutyMs << "x"
+                      << std::setw(14) << std::setprecision(3) << copyMs
+                      << "   (" << overworked << " / " << recalculated << " / " << rebuilt.getOverworkedAircraft().size()
+                      << " / " << legacyOverworked << " самолётов)" << std::endl;
+        }
+    }
+}
+
+static void benchReturnFlights() {
+    std::cout << std::endl << "Обратные рейсы (удвоение расписания)" << std::endl;
+    std::cout << std::setw(10) << "flights" << std::setw(16) << "all, ms"
+              << std::setw(22) << "rejectConflicts, ms" << std::endl;
+    
+    const int sizes[] = {100000, 1000000};
+    for (int size : sizes) {
+        auto batch = makeFlights(size, size / 20);
+        Schedule all;
+        all.addFlights(batch);
+        Schedule checked(all);
+        
+        auto start = BenchClock::now();
+        int added = all.addReturnFlights();
+        double allMs = elapsedMs(start);
+        
+        start = BenchClock::now();
+        int accepted = checked.addReturnFlights(true);
+        double checkedMs = elapsedMs(start);
+        
+        std::cout << std::setw(10) << size << std::setw(16) << std::fixed << std::setprecision(3) << allMs
+                  << std::setw(22) << checkedMs << "   (" << added << " / " << accepted << " рейсов)" << std::endl;
+    }
+}
+
+static void benchStatusPolling() {
+    std::cout << std::endl << "Опрос счётчиков статусов" << std::endl;
+    std::cout << std::setw(10) << "flights" << std::setw(18) << "tracker, us"
+              << std::setw(16) << "scan, us" << std::endl;
+    
+    const int sizes[] = {100000, 1000000};
+    const int polls = 1000;
+    for (int size : sizes) {
+        Schedule schedule;
+        auto batch = makeFlights(size, size / 20);
+        // Сдвигаем рейсы так, чтобы текущий момент попадал внутрь расписания
+        std::time_t shift = std::time(nullptr) - 1700000000 - 12 * 3600;
+        for (const auto& flight : batch) {
+            flight->setDepartureTime(flight->getDepartureTime() + shift);
+            flight->setArrivalTime(flight->getArrivalTime() + shift);
+        }
+        schedule.addFlights(batch);
+        
+        long long counted = 0;
+        auto start = BenchClock::now();
+        for (int i = 0; i < polls; ++i) {
+            counted += schedule.getScheduledFlights() + schedule.getInProgressFlights() +
+                       schedule.getCompletedFlights();
+        }
+        double trackerUs = elapsedMs(start) * 1000.0 / polls;
+        
+        // Прежний способ: перебор всех рейсов с std::time на каждый рейс
+        const int scanPolls = 5;
+        long long scanned = 0;
+        start = BenchClock::now();
+        for (int i = 0; i < scanPolls; ++i) {
+            for (const auto& flight : schedule.getFlights()) {
+                scanned += flight->isScheduled() + flight->isInProgress() + flight->isCompleted();
+            }
+        }
+        double scanUs = elapsedMs(start) * 1000.0 / scanPolls;
+        
+        std::cout << std::setw(10) << size << std::setw(18) << std::fixed << std::setprecision(3) << trackerUs
+                  << std::setw(16) << scanUs << "   (" << counted / polls << " / " << scanned / scanPolls
+                  << " рейсов)" << std::endl;
+    }
+}
+
+static void benchOverdueCargo() {
+    std::cout << std::endl << "Выборка просроченных срочных грузов" << std::endl;
+    std::cout << std::setw(10) << "cargo" << std::setw(18) << "index, us"
+              << std::setw(16) << "scan, us" << std::endl;
+    
+    const int sizes[] = {10000, 200000};
+    for (int size : sizes) {
+        std::time_t now = std::time(nullptr);
+        Schedule schedule;
+        std::vector<std::shared_ptr<Aircraft>> fleet;
+        std::mt19937 rng(11);
+        for (int i = 0; i < size / 100; ++i) {
+            fleet.push_back(std::make_shared<Aircraft>("A" + std::to_string(i), 1e9));
+            schedule.registerAircraft(fleet.back());
+        }
+        for (int i = 0; i < size; ++i) {
+            std::time_t deadline = now + 60 + static_cast<std::time_t>(rng() % (30 * 24 * 3600));
+            fleet[i % fleet.size()]->addUrgentCargo(std::make_shared<UrgentCargo>(
+                "C" + std::to_string(i), 1.0, "SVO", "LED", "SVO", now, deadline));
+        }
+        // Отчёт за сутки вперёд: просрочена малая доля грузов
+        auto clock = std::make_shared<ManualClock>(now + 24 * 3600);
+        schedule.setClock(clock);
+        
+        const int polls = 200;
+        size_t found = 0;
+        auto start = BenchClock::now();
+        for (int i = 0; i < polls; ++i) {
+            found += schedule.getOverdueUrgentCargo().size();
+        }
+        double indexUs = elapsedMs(start) * 1000.0 / polls;
+        
+        // Прежний способ: перебор всех грузов каждого самолёта
+        const int scanPolls = 5;
+        size_t scanned = 0;
+        start = BenchClock::now();
+        for (int i = 0; i < scanPolls; ++i) {
+            for (const auto& aircraft : fleet) {
+                for (const auto& cargo : aircraft->getUrgentCargoList()) {
+                    scanned += cargo->isOverdue(clock->now());
+                }
+            }
+        }
+        double scanUs = elapsedMs(start) * 1000.0 / scanPolls;
+        
+        std::cout << std::setw(10) << size << std::setw(18) << std::fixed << std::setprecision(3) << indexUs
+                  << std::setw(16) << scanUs << "   (" << found / polls << " / " << scanned / scanPolls
+                  << " грузов)" << std::endl;
+    }
+}
+
+static void benchEvents() {
+    std::cout << std::endl << "События за сутки с шагом в минуту" << std::endl;
+    std::cout << std::setw(10) << "flights" << std::setw(14) << "setup, ms" << std::setw(18) << "engine, us/step"
+              << std::setw(16) << "scan, us/step" << std::endl;
+    
+    const int sizes[] = {100000, 1000000};
+    for (int size : sizes) {
+        Schedule schedule;
+        schedule.addFlights(makeFlights(size, size / 20));
+        auto clock = std::make_shared<ManualClock>(1700000000);
+        schedule.setClock(clock);
+        
+        auto start = BenchClock::now();
+        size_t delivered = 0;
+        schedule.addEventListener([&delivered](const std::vector<ScheduleEvent>& batch) { delivered += batch.size(); });
+        double setupMs = elapsedMs(start);
+        
+        const int steps = 24 * 60;
+        start = BenchClock::now();
+        for (int i = 0; i < steps; ++i) {
+            clock->advance(60);
+            schedule.processEvents();
+        }
+        double engineUs = elapsedMs(start) * 1000.0 / steps;
+        
+        // Прежний способ: на каждом шаге перебор всех рейсов и сравнение статусов с прошлым шагом
+        const int scanSteps = 20;
+        size_t changed = 0;
+        std::time_t previous = clock->now();
+        start = BenchClock::now();
+        for (int i = 0; i < scanSteps; ++i) {
+            std::time_t now = previous + 60;
+            for (const auto& flight : schedule.getFlights()) {
+                changed += (flight->isInProgress(now) != flight->isInProgress(previous)) ||
+                           (flight->isScheduled(now) != flight->isScheduled(previous));
+            }
+            previous = now;
+        }
+        double scanUs = elapsedMs(start) * 1000.0 / scanSteps;
+        
+        std::cout << std::setw(10) << size << std::setw(14) << std::fixed << std::setprecision(1) << setupMs
+                  << std::setw(18) << std::setprecision(3) << engineUs << std::setw(16) << scanUs
+                  << "   (" << delivered << " событий)" << std::endl;
+    }
+}
+
+static void benchReschedule() {
+    std::cout << std::endl << "Перенос рейсов на 10 минут" << std::endl;
+    std::cout << std::setw(10) << "flights" << std::setw(22) << "rescheduleFlight, us"
+              << std::setw(20) << "remove+add, us" << std::endl;
+    
+    const int sizes[] = {100000, 1000000};
+    const int moves = 2000;
+    for (int size : sizes) {
+        Schedule schedule;
+        schedule.addFlights(makeFlights(size, size / 20));
+        std::vector<std::string> numbers;
+        for (int i = 0; i < moves; ++i) {
+            numbers.push_back(schedule.getFlights()[(static_cast<size_t>(i) * 7919) % size]->getFlightNumber());
+        }
+        
+        auto start = BenchClock::now();
+        int accepted = 0;
+        for (const auto& number : numbers) {
+            auto flight = schedule.findFlight(number);
+            accepted += schedule.rescheduleFlight(number, flight->getDepartureTime() + 600,
+                                                  flight->getArrivalTime() + 600).status == FlightCheckStatus::Ok;
+        }
+        double rescheduleUs = elapsedMs(start) * 1000.0 / moves;
+        
+        // Прежний способ: удалить рейс, изменить время и добавить заново
+        start = BenchClock::now();
+        for (const auto& number : numbers) {
+            auto flight = schedule.findFlight(number);
+            schedule.removeFlight(number);
+            flight->setDepartureTime(flight->getDepartureTime() + 600);
+            flight->setArrivalTime(flight->getArrivalTime() + 600);
+            schedule.addFlight(flight);
+        }
+        double readdUs = elapsedMs(start) * 1000.0 / moves;
+        
+        std::cout << std::setw(10) << size << std::setw(22) << std::fixed << std::setprecision(1) << rescheduleUs
+                  << std::setw(20) << readdUs << "   (" << accepted << " перенесено)" << std::endl;
+    }
+}
+
+static void benchDelays() {
+    std::cout << std::endl << "Распространение 10000 задержек по 15 минут" << std::endl;
+    std::cout << std::setw(10) << "flights" << std::setw(18) << "propagate, ms"
+              << std::setw(16) << "moved" << std::setw(22) << "one isValid(), ms" << std::endl;
+    
+    const int sizes[] = {100000, 1000000};
+    const int delays = 10000;
+    for (int size : sizes) {
+        Schedule schedule;
+        schedule.addFlights(makeFlights(size, size / 20));
+        std::vector<std::string> numbers;
+        for (int i = 0; i < delays; ++i) {
+            numbers.push_back(schedule.getFlights()[(static_cast<size_t>(i) * 7919) % size]->getFlightNumber());
+        }
+        DelayPropagator propagator(schedule);
+        
+        auto start = BenchClock::now();
+        size_t moved = 0;
+        for (const auto& number : numbers) {
+            moved += propagator.applyDelay(number, 900).changes.size();
+        }
+        double propagateMs = elapsedMs(start);
+        
+        // Прежний способ: полная проверка расписания после изменений
+        start = BenchClock::now();
+        bool valid = schedule.isValid();
+        double validateMs = elapsedMs(start);
+        
+        std::cout << std::setw(10) << size << std::setw(18) << std::fixed << std::setprecision(1) << propagateMs
+                  << std::setw(16) << moved << std::setw(22) << validateMs
+                  << (valid ? "" : "   (есть конфликты за горизонтом)") << std::endl;
+    }
+}
+
+static void benchHandles() {
+    std::cout << std::endl << "Добавление и поиск рейсов через дескрипторы C API" << std::endl;
+    std::cout << std::setw(10) << "flights" << std::setw(16) << "add+find, ms"
+              << std::setw(22) << "allocations/flight" << std::setw(16) << "bytes/flight" << std::endl;
+    
+    const int size = 20000;
+    std::vector<std::shared_ptr<Flight>> flights = makeFlights(size, size / 20);
+    ScheduleHandle schedule = Schedule_Create();
+    std::size_t allocationsBefore = allocationCount;
+    std::size_t bytesBefore = allocatedBytes;
+    auto start = BenchClock::now();
+    for (const auto& flight : flights) {
+        FlightHandle handle = Flight_Create(flight->getFlightNumber().c_str(), flight->getDepartureAirport().c_str(),
+            flight->getDestinationAirport().c_str(), flight->getDepartureTime(), flight->getArrivalTime(),
+            flight->getAircraftId().c_str());
+        Schedule_AddFlight(schedule, handle);
+        Flight_Destroy(handle);
+        FlightHandle found = Schedule_FindFlight(schedule, flight->getFlightNumber().c_str());
+        Flight_Destroy(found);
+    }
+    double elapsed = elapsedMs(start);
+    double perFlight = static_cast<double>(allocationCount - allocationsBefore) / size;
+    double bytesPerFlight = static_cast<double>(allocatedBytes - bytesBefore) / size;
+    Schedule_Destroy(schedule);
+    
+    std::cout << std::setw(10) << size << std::setw(16) << std::fixed << std::setprecision(1) << elapsed
+              << std::setw(22) << perFlight << std::setw(16) << bytesPerFlight << std::endl;
+}
+
+static void benchBatchApi() {
+    std::cout << std::endl << "Загрузка рейсов через C API" << std::endl;
+    std::cout << std::setw(10) << "flights" << std::setw(22) << "Create+AddFlight, ms"
+              << std::setw(20) << "AddFlightsBatch, ms" << std::endl;
+    
+    // Поштучное добавление в упорядоченные списки квадратично, поэтому без 10^6
+    const int sizes[] = {10000, 100000};
+    for (int size : sizes) {
+        std::vector<std::shared_ptr<Flight>> flights = makeFlights(size, size / 20);
+        
+        // Прежний способ: объект на каждый рейс и вызов на каждое добавление
+        auto start = BenchClock::now();
+        ScheduleHandle perRow = Schedule_Create();
+        for (const auto& flight : flights) {
+            FlightHandle handle = Flight_Create(flight->getFlightNumber().c_str(), flight->getDepartureAirport().c_str(),
+                flight->getDestinationAirport().c_str(), flight->getDepartureTime(), flight->getArrivalTime(),
+                flight->getAircraftId().c_str());
+            Schedule_AddFlight(perRow, handle);
+            Flight_Destroy(handle);
+        }
+        double perRowMs = elapsedMs(start);
+        Schedule_Destroy(perRow);
+        
+        // Таблица строк готовится вызывающей стороной и в замер не входит
+        std::string table;
+        std::map<std::string, int> offsets;
+        auto offsetOf = [&](const std::string& text) {
+            auto it = offsets.find(text);
+            if (it != offsets.end()) return it->second;
+            int offset = static_cast<int>(table.size());
+            table += text;
+            table += '\0';
+            offsets.emplace(text, offset);
+            return offset;
+        };
+        std::vector<FlightRow> rows;
+        rows.reserve(flights.size());
+        for (const auto& flight : flights) {
+            rows.push_back(FlightRow{offsetOf(flight->getFlightNumber()), offsetOf(flight->getDepartureAirport()),
+                offsetOf(flight->getDestinationAirport()), offsetOf(flight->getAircraftId()),
+                flight->getDepartureTime(), flight->getArrivalTime()});
+        }
+        
+        start = BenchClock::now();
+        ScheduleHandle batch = Schedule_Create();
+        int added = Schedule_AddFlightsBatch(batch, rows.data(), static_cast<int>(rows.size()),
+                                             table.data(), static_cast<int>(table.size()), nullptr);
+        double batchMs = elapsedMs(start);
+        Schedule_Destroy(batch);
+        
+        std::cout << std::setw(10) << size << std::setw(22) << std::fixed << std::setprecision(1) << perRowMs
+                  << std::setw(20) << batchMs << "   (" << added << " добавлено)" << std::endl;
+    }
+}
+
+static void benchColumnExport() {
+    std::cout << std::endl << "Выгрузка рейсов в столбцы через C API" << std::endl;
+    std::cout << std::setw(10) << "flights" << std::setw(18) << "ExportColumns, ms"
+              << std::setw(20) << "ToStringAlloc, ms" << std::endl;
+    
+    const int sizes[] = {100000, 1000000};
+    for (int size : sizes) {
+        ScheduleHandle handle = Schedule_Create();
+        static_cast<Schedule*>(handle)->addFlights(makeFlights(size, size / 20));
+        std::vector<long long> departures(size), arrivals(size);
+        std::vector<int> aircraft(size), from(size), to(size);
+        std::vector<unsigned char> statuses(size);
+        std::vector<char> numbers(static_cast<size_t>(size) * 16);
+        FlightColumns columns = {};
+        columns.capacity = size;
+        columns.departureTimes = departures.data();
+        columns.arrivalTimes = arrivals.data();
+        columns.aircraftCodes = aircraft.data();
+        columns.departureCodes = from.data();
+        columns.destinationCodes = to.data();
+        columns.statuses = statuses.data();
+        columns.flightNumbers = numbers.data();
+        columns.flightNumberWidth = 16;
+        
+        auto start = BenchClock::now();
+        int rows = Schedule_ExportColumns(handle, &columns);
+        double exportMs = elapsedMs(start);
+        FlightSchedule_FreeString(columns.dictionary);
+        
+        // Прежний способ: текстовый отчёт, который затем разбирается на стороне Python
+        start = BenchClock::now();
+        char* text = Schedule_ToStringAlloc(handle);
+        double textMs = elapsedMs(start);
+        FlightSchedule_FreeString(text);
+        Schedule_Destroy(handle);
+        
+        std::cout << std::setw(10) << size << std::setw(18) << std::fixed << std::setprecision(1) << exportMs
+                  << std::setw(20) << textMs << "   (" << rows << " строк)" << std::endl;
+    }
+}
+
+int main() {
+    if (benchConflicts() != 0) {
+        return 1;
+    }
+    benchLoading();
+    if (benchRangeQueries() != 0) {
+        return 1;
+    }
+    benchOverworked();
+    benchReturnFlights();
+    benchStatusPolling();
+    benchOverdueCargo();
+    benchEvents();
+    benchReschedule();
+    benchDelays();
+    benchHandles();
+    benchBatchApi();
+    benchColumnExport();
+    return 0;
+}